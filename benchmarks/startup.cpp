@@ -0,0 +1,165 @@
+// Copyright (c) 2019 Johannes Zeppenfeld
+// SPDX-License-Identifier: MIT
+
+#include "reflect/register.h"
+
+// std::chrono
+#include <chrono>
+// std::size_t
+#include <cstddef>
+#include <iostream>
+#include <string>
+
+//------------------------------------------------------------------------------
+//--                                  Types                                   --
+//------------------------------------------------------------------------------
+// Measures the startup cost of registering 10000 types, each with a name and
+// a base class, either eagerly or deferred until first use.
+// Registration is performed through the type information directly, since
+// instantiating Register for tens of thousands of types exceeds the memory
+// available to most compilers.
+
+namespace {
+    using Reflect::Detail::IndexSequence;
+    using Reflect::Detail::MakeIndexSequence;
+    using Reflect::Detail::TypeInfo;
+
+    constexpr std::size_t Outer = 100;
+    constexpr std::size_t Inner = 100;
+
+    struct Root { };
+
+    template <std::size_t T_Outer, std::size_t T_Inner>
+    struct EagerType : Root { };
+
+    template <std::size_t T_Outer, std::size_t T_Inner>
+    struct DeferredType : Root { };
+
+    // Upcast any of the types to Root, which is their first and only base.
+    void const *upcast(void const *value) {
+        return value;
+    }
+
+    // Register the type associated with typeInfo with a unique name and base
+    // class. Kept out of the per-type templates to limit compilation time.
+    void registerType(TypeInfo *typeInfo, char const *prefix,
+                      std::size_t index) {
+        typeInfo->registerName(prefix + std::to_string(index));
+        typeInfo->registerBase(
+            Reflect::Detail::Base(TypeInfo::instance<Root>(), &upcast)
+        );
+    }
+
+    // Register type EagerType<T_Outer, T_Inner> immediately.
+    template <std::size_t T_Outer, std::size_t T_Inner>
+    int registerEager() {
+        registerType(TypeInfo::mutableInstance<EagerType<T_Outer, T_Inner>>(),
+                     "Eager", T_Outer * Inner + T_Inner);
+        return 0;
+    }
+
+    template <std::size_t T_Outer, std::size_t T_Inner>
+    void registerDeferredType() {
+        registerType(
+            TypeInfo::mutableInstance<DeferredType<T_Outer, T_Inner>>(),
+            "Deferred", T_Outer * Inner + T_Inner
+        );
+    }
+
+    // Defer registration of type DeferredType<T_Outer, T_Inner>.
+    template <std::size_t T_Outer, std::size_t T_Inner>
+    int registerDeferred() {
+        static Reflect::DeferredRegister<
+            DeferredType<T_Outer, T_Inner>
+        > registration(&registerDeferredType<T_Outer, T_Inner>);
+        return 0;
+    }
+
+    // Retrieve the name of type DeferredType<T_Outer, T_Inner>, executing its
+    // deferred registration.
+    template <std::size_t T_Outer, std::size_t T_Inner>
+    int useDeferred() {
+        return static_cast<int>(
+            TypeInfo::instance<DeferredType<T_Outer, T_Inner>>()
+                ->getName().size()
+        );
+    }
+
+    // Call each of the specified functions, returning the sum of results.
+    template <int (*...T_Funcs)()>
+    int call() {
+        int results[] = { T_Funcs()... };
+        int sum = 0;
+        for(int result : results) sum += result;
+        return sum;
+    }
+
+    template <std::size_t T_Outer, std::size_t ...T_Inners>
+    int eagerInner(IndexSequence<T_Inners...>) {
+        return call<&registerEager<T_Outer, T_Inners>...>();
+    }
+
+    template <std::size_t ...T_Outers>
+    int eagerOuter(IndexSequence<T_Outers...>) {
+        int results[] = {
+            eagerInner<T_Outers>(MakeIndexSequence<Inner>())...
+        };
+        return results[0];
+    }
+
+    template <std::size_t T_Outer, std::size_t ...T_Inners>
+    int deferredInner(IndexSequence<T_Inners...>) {
+        return call<&registerDeferred<T_Outer, T_Inners>...>();
+    }
+
+    template <std::size_t ...T_Outers>
+    int deferredOuter(IndexSequence<T_Outers...>) {
+        int results[] = {
+            deferredInner<T_Outers>(MakeIndexSequence<Inner>())...
+        };
+        return results[0];
+    }
+
+    template <std::size_t T_Outer, std::size_t ...T_Inners>
+    int useInner(IndexSequence<T_Inners...>) {
+        return call<&useDeferred<T_Outer, T_Inners>...>();
+    }
+
+    // Measure the time taken by func in microseconds.
+    template <typename T_Func>
+    long long measure(T_Func func) {
+        auto start = std::chrono::steady_clock::now();
+        func();
+        auto stop = std::chrono::steady_clock::now();
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+            stop - start
+        ).count();
+    }
+}
+
+//------------------------------------------------------------------------------
+//--                                Benchmark                                 --
+//------------------------------------------------------------------------------
+
+int main() {
+    std::size_t count = Outer * Inner;
+
+    long long eager = measure([]() {
+        eagerOuter(MakeIndexSequence<Outer>());
+    });
+    long long deferred = measure([]() {
+        deferredOuter(MakeIndexSequence<Outer>());
+    });
+    long long used = measure([]() {
+        useInner<0>(MakeIndexSequence<Inner>());
+    });
+
+    std::cout << "Registering " << count << " types eagerly:     "
+              << eager << " us\n"
+              << "Deferring " << count << " type registrations:  "
+              << deferred << " us\n"
+              << "Executing " << Inner << " deferred registrations: "
+              << used << " us\n";
+
+    return 0;
+}
@@ -0,0 +1,80 @@
+// Copyright (c) 2019 Johannes Zeppenfeld
+// SPDX-License-Identifier: MIT
+
+#ifndef REFLECT_BINDING_H
+#define REFLECT_BINDING_H
+
+#include "object.h"
+
+#include "detail/base.h"
+#include "detail/conversion.h"
+
+// std::vector
+#include <vector>
+
+//------------------------------------------------------------------------------
+//--                         Begin Namespace Reflect                          --
+namespace Reflect {
+
+//------------------------------------------------------------------------------
+//--                              Class Binding                               --
+//------------------------------------------------------------------------------
+// This class repeatedly assigns the value of a source object to a target
+// object. The route from the source's reflected type to the target's reflected
+// type, i.e., the registered base classes and conversion to traverse, is
+// resolved on first application and reused for subsequent applications, so
+// long as neither the source's nor the target's reflected type changes.
+class Binding {
+public:
+    // Construct an unresolved binding.
+    Binding();
+
+//-----------------------------  Public Interface  -----------------------------
+public:
+    // Copy-assign the value of source to target.
+    // Throws an exception if target cannot be set from the reflected type of
+    // source.
+    template <typename T_Target, typename T_Source>
+    void apply(Object<T_Target> &target, Object<T_Source> const &source);
+
+    // Returns true if a route has been resolved.
+    bool isResolved() const { return _target != nullptr; }
+
+//----------------------------  Private Interface  -----------------------------
+private:
+    // Assign the value in source, accessed by sourceAccessor, to the value in
+    // target, accessed by targetAccessor.
+    void apply(Detail::Accessor const *targetAccessor,
+               Detail::Storage &target,
+               Detail::Accessor const *sourceAccessor,
+               Detail::Storage const &source);
+
+    // Resolve the route between the specified accessors.
+    // Throws an exception if no route exists.
+    void resolve(Detail::Accessor const *targetAccessor,
+                 Detail::Accessor const *sourceAccessor);
+
+    // Recursively resolve the upcasts and conversion from source to target.
+    // Returns false if no route exists.
+    bool resolve(Detail::TypeInfo const *source,
+                 Detail::TypeInfo const *target);
+
+//-----------------------------  Private Members  ------------------------------
+private:
+    // Accessors for which the route has been resolved.
+    Detail::Accessor const *_target;
+    Detail::Accessor const *_source;
+    // Upcasts applied to the source value, in order.
+    std::vector<Detail::Base> _upcasts;
+    // Conversion applied to the upcast source value, if _converting is set.
+    Detail::Conversion _conversion;
+    bool _converting;
+};
+
+}
+//--                          End Namespace Reflect                           --
+//------------------------------------------------------------------------------
+
+#include "binding.hpp"
+
+#endif
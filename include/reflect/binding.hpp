@@ -0,0 +1,20 @@
+// Copyright (c) 2019 Johannes Zeppenfeld
+// SPDX-License-Identifier: MIT
+
+//------------------------------------------------------------------------------
+//--                         Begin Namespace Reflect                          --
+namespace Reflect {
+
+//------------------------------------------------------------------------------
+//--                              Class Binding                               --
+//------------------------------------------------------------------------------
+
+// Copy-assign the value of source to target.
+template <typename T_Target, typename T_Source>
+void Binding::apply(Object<T_Target> &target, Object<T_Source> const &source) {
+    apply(target._accessor, target._storage, source._accessor, source._storage);
+}
+
+}
+//--                          End Namespace Reflect                           --
+//------------------------------------------------------------------------------
@@ -65,7 +65,7 @@ public:
     // type associated with typeInfo.
     // An optional buffer may be provided into which an instance of the type
     // associated with typeInfo can be constructed (if necessary).
-    // Throws an exception if the value cannot be retrieved as specified.
+    // Raises an error if the value cannot be retrieved as specified.
     void *getAs(Storage const &storage,
                 TypeInfo const *typeInfo,
                 Buffer<void> *buffer = nullptr) const;
@@ -74,6 +74,16 @@ public:
                            TypeInfo const *typeInfo,
                            Buffer<void> *buffer = nullptr) const;
 
+    // Retrieve the value in storage as for getAs and getAsConst, but return
+    // nullptr instead of raising an error if the value cannot be retrieved as
+    // specified.
+    void *tryGetAs(Storage const &storage,
+                   TypeInfo const *typeInfo,
+                   Buffer<void> *buffer = nullptr) const;
+    void const *tryGetAsConst(Storage const &storage,
+                              TypeInfo const *typeInfo,
+                              Buffer<void> *buffer = nullptr) const;
+
     // Set the value in storage by copy-assigning the specified value.
     // Storage and value must both be of the accessed type.
     // Returns false if the accessed value cannot be assigned.
@@ -83,7 +93,7 @@ public:
 
     // Set the value in storage, which must be of the accessed type, by
     // copy-assigning the specified value of the type associated with typeInfo.
-    // Throws an exception if the assignment cannot be made as specified.
+    // Raises an error if the assignment cannot be made as specified.
     void setAs(Storage &storage,
                TypeInfo const *typeInfo,
                void const *value) const;
@@ -92,6 +102,12 @@ public:
                Accessor const *accessor,
                Storage const &value) const;
 
+    // Set the value in storage as for setAs, but return false instead of
+    // raising an error if the assignment cannot be made as specified.
+    bool trySetAs(Storage &storage,
+                  TypeInfo const *typeInfo,
+                  void const *value) const;
+
     // Set the value in storage by move-assigning the specified value.
     // Storage and value must both be of the accessed type.
     // Defaults to copy-assignment if move-assignment is not possible.
@@ -102,7 +118,7 @@ public:
 
     // Set the value in storage, which must be of the accessed type, by
     // move-assigning the specified value of the type associated with typeInfo.
-    // Throws an exception if the assignment cannot be made as specified.
+    // Raises an error if the assignment cannot be made as specified.
     void moveAs(Storage &storage,
                 TypeInfo const *typeInfo,
                 void *value) const;
@@ -111,6 +127,12 @@ public:
                 Accessor const *accessor,
                 Storage &value) const;
 
+    // Set the value in storage as for moveAs, but return false instead of
+    // raising an error if the assignment cannot be made as specified.
+    bool tryMoveAs(Storage &storage,
+                   TypeInfo const *typeInfo,
+                   void *value) const;
+
 //-----------------------------  Type Reflection  ------------------------------
 public:
     // Retrieve the type information of the accessed type.
@@ -0,0 +1,156 @@
+// Copyright (c) 2019 Johannes Zeppenfeld
+// SPDX-License-Identifier: MIT
+
+#ifndef REFLECT_DETAIL_ALTERNATIVES_H
+#define REFLECT_DETAIL_ALTERNATIVES_H
+
+// std::size_t
+#include <cstddef>
+// std::tuple_element
+#include <tuple>
+// std::integral_constant, std::is_same et al.
+#include <type_traits>
+
+//------------------------------------------------------------------------------
+//--                     Begin Namespace Reflect::Detail                      --
+namespace Reflect { namespace Detail {
+
+// Determine the maximum of the specified values.
+constexpr std::size_t maxOf(std::size_t value) {
+    return value;
+}
+
+template <typename ...T_Values>
+constexpr std::size_t maxOf(std::size_t first, std::size_t second,
+                            T_Values ...rest) {
+    return maxOf(first > second ? first : second, rest...);
+}
+
+//------------------------------------------------------------------------------
+//--                            Class Alternatives                            --
+//------------------------------------------------------------------------------
+// Provides compile-time information about a closed list of alternative types,
+// and dispatch over the alternatives by index.
+template <typename ...Ts>
+class Alternatives {
+//----------------------------  Private Interface  -----------------------------
+private:
+    // Determine the index of T within T_Others, or the number of types in
+    // T_Others if T is not among them.
+    template <typename T, typename ...T_Others>
+    struct IndexOf : std::integral_constant<std::size_t, 0> { };
+
+    template <typename T, typename T_First, typename ...T_Others>
+    struct IndexOf<T, T_First, T_Others...>
+    : std::integral_constant<
+        std::size_t,
+        std::is_same<T, T_First>::value
+            ? 0 : 1 + IndexOf<T, T_Others...>::value
+    > { };
+
+    // Determine whether each type occurs only once.
+    template <typename ...T_Others>
+    struct AreUnique : std::true_type { };
+
+    template <typename T_First, typename ...T_Others>
+    struct AreUnique<T_First, T_Others...>
+    : std::integral_constant<
+        bool,
+        IndexOf<T_First, T_Others...>::value == sizeof...(T_Others) &&
+        AreUnique<T_Others...>::value
+    > { };
+
+    // Determine whether each type is decayed.
+    template <typename ...T_Others>
+    struct AreDecayed : std::true_type { };
+
+    template <typename T_First, typename ...T_Others>
+    struct AreDecayed<T_First, T_Others...>
+    : std::integral_constant<
+        bool,
+        std::is_same<T_First, typename std::decay<T_First>::type>::value &&
+        AreDecayed<T_Others...>::value
+    > { };
+
+    // Call func with the alternative at index.
+    template <typename ...T_Others>
+    struct Switch;
+
+    template <typename T_Last>
+    struct Switch<T_Last> {
+        template <typename T_Result, typename T_Func>
+        static T_Result apply(std::size_t, T_Func &func) {
+            return func.template apply<T_Last>();
+        }
+    };
+
+    template <typename T_First, typename T_Second, typename ...T_Others>
+    struct Switch<T_First, T_Second, T_Others...> {
+        template <typename T_Result, typename T_Func>
+        static T_Result apply(std::size_t index, T_Func &func) {
+            if(index == 0) return func.template apply<T_First>();
+            return Switch<T_Second, T_Others...>::template apply<T_Result>(
+                index - 1, func
+            );
+        }
+    };
+
+//-----------------------------  Public Interface  -----------------------------
+public:
+    // The first alternative.
+    using First = typename std::tuple_element<0, std::tuple<Ts...>>::type;
+
+    // Number of alternatives.
+    static constexpr std::size_t count = sizeof...(Ts);
+
+    // Size and alignment required to hold any of the alternatives.
+    static constexpr std::size_t size = maxOf(sizeof(Ts)...);
+    static constexpr std::size_t alignment = maxOf(alignof(Ts)...);
+
+    // True if no alternative occurs more than once.
+    static constexpr bool unique = AreUnique<Ts...>::value;
+
+    // True if all alternatives are decayed, i.e., neither qualified nor of
+    // array or function type.
+    static constexpr bool decayed = AreDecayed<Ts...>::value;
+
+    // Retrieve the index of alternative T, or count if T is not an
+    // alternative.
+    template <typename T>
+    static constexpr std::size_t indexOf() {
+        return IndexOf<T, Ts...>::value;
+    }
+
+    // Call func.apply<T>(), where T is the alternative at index, returning
+    // its result. Index must be less than count.
+    template <typename T_Result, typename T_Func>
+    static T_Result dispatch(std::size_t index, T_Func &func) {
+        return Switch<Ts...>::template apply<T_Result>(index, func);
+    }
+};
+
+template <typename ...Ts>
+constexpr std::size_t Alternatives<Ts...>::count;
+template <typename ...Ts>
+constexpr std::size_t Alternatives<Ts...>::size;
+template <typename ...Ts>
+constexpr std::size_t Alternatives<Ts...>::alignment;
+template <typename ...Ts>
+constexpr bool Alternatives<Ts...>::unique;
+template <typename ...Ts>
+constexpr bool Alternatives<Ts...>::decayed;
+
+// Determines whether the decayed type of T is one of the alternatives Ts.
+template <typename T, typename ...Ts>
+struct IsAlternative
+: std::integral_constant<
+    bool,
+    Alternatives<Ts...>::template indexOf<typename std::decay<T>::type>()
+        < sizeof...(Ts)
+> { };
+
+} }
+//--                      End Namespace Reflect::Detail                       --
+//------------------------------------------------------------------------------
+
+#endif
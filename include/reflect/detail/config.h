@@ -0,0 +1,54 @@
+// Copyright (c) 2019 Johannes Zeppenfeld
+// SPDX-License-Identifier: MIT
+
+#ifndef REFLECT_DETAIL_CONFIG_H
+#define REFLECT_DETAIL_CONFIG_H
+
+//------------------------------------------------------------------------------
+//--                              Configuration                               --
+//------------------------------------------------------------------------------
+
+// REFLECT_NO_RTTI disables all use of runtime type information, so that the
+// library can be compiled with RTTI disabled, e.g., using -fno-rtti. It is
+// defined automatically if the compiler reports RTTI to be disabled.
+// Without RTTI, the implementation-defined name of a type is extracted from
+// the compiler's function signature, and dynamic references refer to the
+// static type of the referenced value.
+#if !defined(REFLECT_NO_RTTI)
+#if defined(__clang__)
+#if !__has_feature(cxx_rtti)
+#define REFLECT_NO_RTTI
+#endif
+#elif defined(__GNUC__)
+#if !defined(__GXX_RTTI)
+#define REFLECT_NO_RTTI
+#endif
+#elif defined(_MSC_VER)
+#if !defined(_CPPRTTI)
+#define REFLECT_NO_RTTI
+#endif
+#endif
+#endif
+
+// REFLECT_NO_EXCEPTIONS disables all use of exceptions, so that the library can
+// be compiled with exceptions disabled, e.g., using -fno-exceptions. It is
+// defined automatically if the compiler reports exceptions to be disabled.
+// Without exceptions, errors are reported to the installed error handler
+// only, after which the program is aborted.
+#if !defined(REFLECT_NO_EXCEPTIONS)
+#if defined(__clang__)
+#if !__has_feature(cxx_exceptions)
+#define REFLECT_NO_EXCEPTIONS
+#endif
+#elif defined(__GNUC__)
+#if !defined(__EXCEPTIONS)
+#define REFLECT_NO_EXCEPTIONS
+#endif
+#elif defined(_MSC_VER)
+#if !defined(_CPPUNWIND)
+#define REFLECT_NO_EXCEPTIONS
+#endif
+#endif
+#endif
+
+#endif
@@ -4,6 +4,9 @@
 #ifndef REFLECT_DETAIL_CONVERSION_H
 #define REFLECT_DETAIL_CONVERSION_H
 
+// std::size_t
+#include <cstddef>
+
 //------------------------------------------------------------------------------
 //--                     Begin Namespace Reflect::Detail                      --
 namespace Reflect { namespace Detail {
@@ -20,16 +23,35 @@ class TypeInfo;
 // Contains information about a conversion from one type to another.
 class Conversion {
 public:
+    // Construct an empty conversion, which must be assigned before use.
+    Conversion()
+    : _typeInfo(nullptr)
+    , _getFunc(nullptr)
+    , _setFunc(nullptr)
+    , _moveFunc(nullptr)
+    , _destructFunc(nullptr)
+    , _size(0)
+    , _alignment(0)
+    , _cost(0) { }
+
     Conversion(TypeInfo const *typeInfo,
                void *(*getFunc)(void const *value, Buffer<void> &buffer),
                bool (*setFunc)(Accessor const *accessor, Storage &storage,
                                void const *value),
                bool (*moveFunc)(Accessor const *accessor, Storage &storage,
-                                void *value))
+                                void *value),
+               void (*destructFunc)(void *value),
+               std::size_t size,
+               std::size_t alignment,
+               unsigned cost)
     : _typeInfo(typeInfo)
     , _getFunc(getFunc)
     , _setFunc(setFunc)
-    , _moveFunc(moveFunc) { }
+    , _moveFunc(moveFunc)
+    , _destructFunc(destructFunc)
+    , _size(size)
+    , _alignment(alignment)
+    , _cost(cost) { }
 
 //-----------------------------  Public Interface  -----------------------------
 public:
@@ -57,6 +79,19 @@ public:
         return _moveFunc(accessor, storage, value);
     }
 
+    // Destruct value, which must be of the target type and have been
+    // constructed by get.
+    void destruct(void *value) const {
+        _destructFunc(value);
+    }
+
+    // Retrieve the size and alignment of the target type.
+    std::size_t getSize() const { return _size; }
+    std::size_t getAlignment() const { return _alignment; }
+
+    // Retrieve the cost of the conversion relative to other conversions.
+    unsigned getCost() const { return _cost; }
+
 //-----------------------------  Private Members  ------------------------------
 private:
     // Type information of the target type.
@@ -69,6 +104,13 @@ private:
     // Pointer to converting move function.
     bool (*_moveFunc)(Accessor const *accessor, Storage &storage,
                       void *value);
+    // Pointer to target type destruct function.
+    void (*_destructFunc)(void *value);
+    // Size and alignment of the target type.
+    std::size_t _size;
+    std::size_t _alignment;
+    // Relative cost of the conversion.
+    unsigned _cost;
 };
 
 } }
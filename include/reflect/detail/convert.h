@@ -0,0 +1,115 @@
+// Copyright (c) 2019 Johannes Zeppenfeld
+// SPDX-License-Identifier: MIT
+
+#ifndef REFLECT_DETAIL_CONVERT_H
+#define REFLECT_DETAIL_CONVERT_H
+
+// std::pair
+#include <utility>
+// std::vector
+#include <vector>
+
+//------------------------------------------------------------------------------
+//--                     Begin Namespace Reflect::Detail                      --
+namespace Reflect { namespace Detail {
+
+// Uses.
+class Accessor;
+class Base;
+template <typename T> class Buffer;
+class Conversion;
+class Storage;
+class TypeInfo;
+
+//------------------------------------------------------------------------------
+//--                               Conversions                                --
+//------------------------------------------------------------------------------
+
+// Retrieve value, which must be of the type associated with source, as the
+// type associated with target, using registered base classes and conversions.
+// If transitive conversions are enabled and no single conversion applies, the
+// cheapest chain of conversions is used instead.
+// If referable is true, a direct reference to value may be returned.
+// If movable is true, value references a temporary that may be moved.
+// An optional buffer may be provided into which an instance of the target type
+// can be constructed (if necessary).
+// Returns nullptr if the value cannot be retrieved as specified.
+void *convert(TypeInfo const *source, void *value, TypeInfo const *target,
+              bool referable, bool movable, Buffer<void> *buffer);
+
+// Convert value from the type associated with source and copy-assign it to the
+// value in storage, which must be of the type accessed by accessor.
+// Returns false if the value cannot be assigned.
+bool convertAndSet(Accessor const *accessor, Storage &storage,
+                   TypeInfo const *source, void const *value);
+
+// Convert value from the type associated with source and move-assign it to the
+// value in storage, which must be of the type accessed by accessor.
+// Returns false if the value cannot be assigned.
+bool convertAndMove(Accessor const *accessor, Storage &storage,
+                    TypeInfo const *source, void *value);
+
+//---------------------------  Conversion Chains  ------------------------------
+
+// Chain of base class upcasts and conversions leading from a source type to a
+// target type.
+struct ConversionPath {
+    // Single upcast or conversion within the chain. Exactly one of the two
+    // pointers is set.
+    struct Step {
+        Base const *base;
+        Conversion const *conversion;
+    };
+
+    // Type information of the target type.
+    TypeInfo const *target;
+    // Sum of the costs of the conversions within the chain.
+    unsigned cost;
+    // Upcasts and conversions to apply, in order.
+    std::vector<Step> steps;
+};
+
+// Retrieve the cheapest chains of conversions leading from source to every
+// type reachable by at least one registered conversion, ordered by increasing
+// cost. Types reachable by upcasts alone are not included.
+// The chains are computed once per thread and source, and remain valid until
+// further base classes or conversions are registered.
+std::vector<ConversionPath> const &getConversionPaths(TypeInfo const *source);
+
+// Retrieve the cheapest chain of conversions leading from source to target.
+// Returns nullptr if target is not reachable by any chain of conversions.
+ConversionPath const *findConversionPath(TypeInfo const *source,
+                                         TypeInfo const *target);
+
+// Chains of conversions leading from each of a number of source types.
+using SourceConversionPaths = std::vector<
+    std::pair<TypeInfo const *, std::vector<ConversionPath>>
+>;
+
+// Install precomputed chains of conversions, ordered by increasing cost, to be
+// used instead of computing them so long as the generation of the registered
+// type graph equals generation. Source types not contained in paths are
+// computed as usual.
+void installConversionPaths(SourceConversionPaths paths,
+                            unsigned long generation);
+
+//-----------------------------  Error Reporting  ------------------------------
+
+// Raise an error indicating that a value of the type associated with
+// source could not be retrieved as the type associated with target.
+[[noreturn]] void raiseGetError(TypeInfo const *source,
+                                bool constant, bool reference,
+                                TypeInfo const *target,
+                                char const *qualifiers);
+
+// Raise an error indicating that a value of the type associated with
+// target could not be set from the type associated with source.
+[[noreturn]] void raiseSetError(TypeInfo const *target,
+                                bool constant, bool reference,
+                                TypeInfo const *source);
+
+} }
+//--                      End Namespace Reflect::Detail                       --
+//------------------------------------------------------------------------------
+
+#endif
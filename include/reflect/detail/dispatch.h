@@ -0,0 +1,88 @@
+// Copyright (c) 2019 Johannes Zeppenfeld
+// SPDX-License-Identifier: MIT
+
+#ifndef REFLECT_DETAIL_DISPATCH_H
+#define REFLECT_DETAIL_DISPATCH_H
+
+// std::size_t
+#include <cstddef>
+// std::initializer_list
+#include <initializer_list>
+// std::vector
+#include <vector>
+
+//------------------------------------------------------------------------------
+//--                         Begin Namespace Reflect                          --
+namespace Reflect {
+
+// Uses.
+class Type;
+
+//------------------------------------------------------------------------------
+//--                          Begin Namespace Detail                          --
+namespace Detail {
+
+// Uses.
+class TypeInfo;
+
+//------------------------------------------------------------------------------
+//--                           Class DispatchTable                            --
+//------------------------------------------------------------------------------
+// Selects among a fixed set of candidate handlers the one whose parameter type
+// best matches a reflected type.
+// An exact match is preferred over an upcast to a base class, which is in turn
+// preferred over a registered conversion. Among equally good matches, the
+// candidate listed first is selected.
+class DispatchTable {
+public:
+    // Candidate handler accepting values of the type associated with typeInfo.
+    struct Candidate {
+        // Type information of the candidate's decayed parameter type.
+        TypeInfo const *typeInfo;
+        // True if the candidate can be passed a reference to the value, which
+        // allows exact matches and upcasts.
+        bool byReference;
+        // True if the candidate can be passed a mutable reference only.
+        bool mutableReference;
+        // True if the candidate can be passed a value, which additionally
+        // allows registered conversions.
+        bool byValue;
+    };
+
+    // Resolved candidate for a reflected type.
+    struct Entry {
+        // Index of the selected candidate.
+        std::size_t index;
+        // True if the selected candidate must be passed a value retrieved by
+        // value rather than by reference.
+        bool byValue;
+    };
+
+    DispatchTable(std::initializer_list<Candidate> candidates)
+    : _candidates(candidates) { }
+
+//-----------------------------  Public Interface  -----------------------------
+public:
+    // Find the candidate best matching the specified reflected type.
+    // The result is cached per thread, so that subsequent lookups for the
+    // same reflected type need not search the registered type information.
+    // Returns nullptr if no candidate can accept the reflected type.
+    Entry const *find(Type const &type) const;
+
+//----------------------------  Private Interface  -----------------------------
+private:
+    // Determine the candidate best matching the specified reflected type.
+    // Returns false if no candidate can accept the reflected type.
+    bool resolve(Type const &type, Entry &entry) const;
+
+//-----------------------------  Private Members  ------------------------------
+private:
+    // List of candidate handlers in order of declaration.
+    std::vector<Candidate> _candidates;
+};
+
+} }
+//--                      End Namespace Reflect::Detail                       --
+//------------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,141 @@
+// Copyright (c) 2019 Johannes Zeppenfeld
+// SPDX-License-Identifier: MIT
+
+#ifndef REFLECT_DETAIL_DYNAMICTYPE_H
+#define REFLECT_DETAIL_DYNAMICTYPE_H
+
+#include "config.h"
+#include "convert.h"
+#include "type_info.h"
+#include "value_accessor.h"
+
+// std::is_polymorphic et al.
+#include <type_traits>
+
+#if !defined(REFLECT_NO_RTTI)
+// std::type_info
+#include <typeinfo>
+#endif
+
+//------------------------------------------------------------------------------
+//--                     Begin Namespace Reflect::Detail                      --
+namespace Reflect { namespace Detail {
+
+//------------------------------------------------------------------------------
+//--                          Class DynamicReference                          --
+//------------------------------------------------------------------------------
+// Wraps a reference to a value whose most-derived registered type is to be
+// used as the reflected type when constructing an object from it.
+template <typename T>
+class DynamicReference {
+public:
+    explicit DynamicReference(T &value) : _value(&value) { }
+
+    // Retrieve the referenced value.
+    T &get() const { return *_value; }
+
+private:
+    T *_value;
+};
+
+//------------------------------------------------------------------------------
+//--                              Dynamic Types                               --
+//------------------------------------------------------------------------------
+
+// Without runtime type information, the dynamic type of a value cannot be
+// determined, so that dynamic references always refer to the static type.
+#if defined(REFLECT_NO_RTTI)
+template <typename T>
+void registerDynamicType() { }
+
+template <typename T, typename T_Polymorphic>
+Accessor const *constructDynamicReference(Storage &storage, T &value,
+                                          T_Polymorphic) {
+    return ValueAccessor<T &>::construct(storage, value);
+}
+#else
+// Registered type that can be looked up by its std::type_info.
+struct DynamicType {
+    // Type information of the registered type.
+    TypeInfo const *typeInfo;
+    // Construct a reference to value, which must be of the registered type,
+    // within storage. Returns an accessor for the constructed reference.
+    Accessor const *(*constructReference)(Storage &storage, void *value,
+                                          bool constant);
+};
+
+// Register type T for lookup by its std::type_info.
+// Registering the same type multiple times has no effect.
+void registerDynamicType(std::type_info const &type,
+                         DynamicType const &dynamicType);
+
+template <typename T>
+void registerDynamicType() {
+    struct Factory {
+        static Accessor const *constructReference(Storage &storage,
+                                                  void *value,
+                                                  bool constant) {
+            if(constant) {
+                return ValueAccessor<T const &>::construct(
+                    storage, *static_cast<T const *>(value)
+                );
+            } else {
+                return ValueAccessor<T &>::construct(
+                    storage, *static_cast<T *>(value)
+                );
+            }
+        }
+    };
+
+    registerDynamicType(typeid(T), {
+        TypeInfo::instance<T>(), &Factory::constructReference
+    });
+}
+
+// Look up the registered type with the specified std::type_info.
+// Returns nullptr if no such type has been registered.
+DynamicType const *findDynamicType(std::type_info const &type);
+
+// Construct a reference to value within storage, using the most-derived
+// registered type of value as the referenced type if it can be upcast to T
+// through registered base classes, and T itself otherwise.
+// Returns an accessor for the constructed reference.
+template <typename T>
+Accessor const *constructDynamicReference(Storage &storage, T &value,
+                                          std::true_type) {
+    using T_Decayed = typename std::decay<T>::type;
+
+    DynamicType const *dynamicType = findDynamicType(typeid(value));
+    TypeInfo const *staticTypeInfo = TypeInfo::instance<T_Decayed>();
+    if(dynamicType && dynamicType->typeInfo != staticTypeInfo) {
+        void *derived = const_cast<void *>(
+            dynamic_cast<void const *>(&value)
+        );
+        void *address = const_cast<T_Decayed *>(&value);
+
+        // The dynamic type must upcast to the referenced value, so that the
+        // object's value can still be retrieved as T.
+        if(convert(dynamicType->typeInfo, derived, staticTypeInfo,
+                   true, false, nullptr) == address) {
+            return dynamicType->constructReference(
+                storage, derived, std::is_const<T>::value
+            );
+        }
+    }
+
+    return ValueAccessor<T &>::construct(storage, value);
+}
+
+template <typename T>
+Accessor const *constructDynamicReference(Storage &storage, T &value,
+                                          std::false_type) {
+    // The dynamic type of a non-polymorphic value is its static type.
+    return ValueAccessor<T &>::construct(storage, value);
+}
+#endif
+
+} }
+//--                      End Namespace Reflect::Detail                       --
+//------------------------------------------------------------------------------
+
+#endif
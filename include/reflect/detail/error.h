@@ -0,0 +1,26 @@
+// Copyright (c) 2019 Johannes Zeppenfeld
+// SPDX-License-Identifier: MIT
+
+#ifndef REFLECT_DETAIL_ERROR_H
+#define REFLECT_DETAIL_ERROR_H
+
+#include <string>
+
+//------------------------------------------------------------------------------
+//--                     Begin Namespace Reflect::Detail                      --
+namespace Reflect { namespace Detail {
+
+//------------------------------------------------------------------------------
+//--                              Error Handling                              --
+//------------------------------------------------------------------------------
+
+// Report an error described by message to the installed error handler.
+// Throws a std::runtime_error if the handler returns, or aborts the program
+// if the library has been built with REFLECT_NO_EXCEPTIONS.
+[[noreturn]] void raiseError(std::string const &message);
+
+} }
+//--                      End Namespace Reflect::Detail                       --
+//------------------------------------------------------------------------------
+
+#endif
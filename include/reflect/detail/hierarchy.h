@@ -0,0 +1,38 @@
+// Copyright (c) 2019 Johannes Zeppenfeld
+// SPDX-License-Identifier: MIT
+
+#ifndef REFLECT_DETAIL_HIERARCHY_H
+#define REFLECT_DETAIL_HIERARCHY_H
+
+//------------------------------------------------------------------------------
+//--                     Begin Namespace Reflect::Detail                      --
+namespace Reflect { namespace Detail {
+
+// Uses.
+class TypeInfo;
+
+//------------------------------------------------------------------------------
+//--                             Class Hierarchy                              --
+//------------------------------------------------------------------------------
+// Subtype queries are answered by an index of the registered base classes of
+// all types, which is rebuilt when first queried after base classes or
+// conversions have been registered.
+// Types whose ancestors all have at most one base class form trees, which
+// are numbered in depth-first order, so that a type is derived from another
+// within the same tree if its interval of numbers lies within the other's.
+// Types with multiple base classes among their ancestors instead store the
+// set of their ancestors as a bitset.
+
+// Returns true if the type associated with derived is the type associated
+// with base, or has it as a direct or indirect registered base class.
+bool isDerived(TypeInfo const *derived, TypeInfo const *base);
+
+// Throw an exception unless the type associated with derived is the type
+// associated with base, or has it as a registered base class.
+void verifyDerived(TypeInfo const *derived, TypeInfo const *base);
+
+} }
+//--                      End Namespace Reflect::Detail                       --
+//------------------------------------------------------------------------------
+
+#endif
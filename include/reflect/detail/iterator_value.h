@@ -4,6 +4,9 @@
 #ifndef REFLECT_DETAIL_ITERATORVALUE_H
 #define REFLECT_DETAIL_ITERATORVALUE_H
 
+// std::iterator_traits
+#include <iterator>
+
 //------------------------------------------------------------------------------
 //--                     Begin Namespace Reflect::Detail                      --
 namespace Reflect { namespace Detail {
@@ -24,8 +27,10 @@ public:
     using value_type = T_Value;
     using pointer = T_Value *;
     using reference = T_Value &;
-    using difference_type = typename T_It::difference_type;
-    using iterator_category = typename T_It::iterator_category;
+    using difference_type =
+        typename std::iterator_traits<T_It>::difference_type;
+    using iterator_category =
+        typename std::iterator_traits<T_It>::iterator_category;
 
 public:
     // Default construct with an uninitialized underlying iterator.
@@ -0,0 +1,54 @@
+// Copyright (c) 2019 Johannes Zeppenfeld
+// SPDX-License-Identifier: MIT
+
+#ifndef REFLECT_DETAIL_NAMEREGISTRY_H
+#define REFLECT_DETAIL_NAMEREGISTRY_H
+
+// std::size_t
+#include <cstddef>
+// std::uint64_t
+#include <cstdint>
+#include <string>
+
+//------------------------------------------------------------------------------
+//--                     Begin Namespace Reflect::Detail                      --
+namespace Reflect { namespace Detail {
+
+// Uses.
+class TypeInfo;
+
+//------------------------------------------------------------------------------
+//--                              Name Registry                               --
+//------------------------------------------------------------------------------
+
+// Compute the 64-bit FNV-1a hash of the specified name.
+inline std::uint64_t hashName(char const *data, std::size_t size) {
+    std::uint64_t hash = 0xcbf29ce484222325ull;
+    for(std::size_t i = 0; i < size; ++i) {
+        hash ^= static_cast<unsigned char>(data[i]);
+        hash *= 0x100000001b3ull;
+    }
+    return hash;
+}
+
+// Globally associate the specified name with the type associated with
+// typeInfo. Registering the same name for the same type multiple times has no
+// effect.
+// Returns the interned name, which remains valid for the remainder of the
+// program.
+// Throws an exception if name has already been registered for a different
+// type.
+std::string const &registerTypeName(char const *data, std::size_t size,
+                                    TypeInfo const *typeInfo);
+
+// Look up the type information globally associated with the specified name.
+// The lookup does not allocate memory and never blocks, even if names are
+// registered concurrently.
+// Returns nullptr if no type has been registered with name.
+TypeInfo const *findTypeName(char const *data, std::size_t size);
+
+} }
+//--                      End Namespace Reflect::Detail                       --
+//------------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,39 @@
+// Copyright (c) 2019 Johannes Zeppenfeld
+// SPDX-License-Identifier: MIT
+
+#ifndef REFLECT_DETAIL_REGISTRYSNAPSHOT_H
+#define REFLECT_DETAIL_REGISTRYSNAPSHOT_H
+
+#include <string>
+
+//------------------------------------------------------------------------------
+//--                     Begin Namespace Reflect::Detail                      --
+namespace Reflect { namespace Detail {
+
+//------------------------------------------------------------------------------
+//--                            Registry Snapshot                             --
+//------------------------------------------------------------------------------
+// A registry snapshot is a versioned binary file describing the registered
+// type graph, identifying types by their stable hashes, together with the
+// cheapest chains of conversions derived from it. Since functions cannot be
+// persisted across processes, the snapshot does not replace registration, but
+// allows a process registering the same type graph to skip deriving the
+// chains of conversions.
+
+// Write a snapshot of the currently registered type graph to the file at
+// path, replacing any existing file.
+// Throws an exception if the file cannot be written, or if two types have the
+// same hash.
+void saveRegistrySnapshot(std::string const &path);
+
+// Read the snapshot from the file at path and, if it matches the currently
+// registered type graph, install the chains of conversions it contains.
+// Returns false if the file cannot be read, was written by an incompatible
+// version or platform, or does not match the registered type graph.
+bool loadRegistrySnapshot(std::string const &path);
+
+} }
+//--                      End Namespace Reflect::Detail                       --
+//------------------------------------------------------------------------------
+
+#endif
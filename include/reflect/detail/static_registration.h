@@ -0,0 +1,118 @@
+// Copyright (c) 2019 Johannes Zeppenfeld
+// SPDX-License-Identifier: MIT
+
+#ifndef REFLECT_DETAIL_STATICREGISTRATION_H
+#define REFLECT_DETAIL_STATICREGISTRATION_H
+
+#include "accessor.h"
+#include "buffer.h"
+#include "type_info.h"
+
+// std::size_t
+#include <cstddef>
+// std::move
+#include <utility>
+
+//------------------------------------------------------------------------------
+//--                     Begin Namespace Reflect::Detail                      --
+namespace Reflect { namespace Detail {
+
+//------------------------------------------------------------------------------
+//--                           Registration Records                           --
+//------------------------------------------------------------------------------
+// Constant-initialized descriptions of registered information, which contain
+// only addresses and constants, and can therefore be placed in read-only
+// memory without running any code at startup.
+
+// Description of a base class of a type.
+struct StaticBase {
+    // Retrieve the type information of the base type.
+    TypeInfo const *(*typeInfo)();
+    // Upcast a value of the derived type to the base type.
+    void const *(*upcast)(void const *value);
+};
+
+// Description of a conversion from a type to another.
+struct StaticConversion {
+    // Retrieve the type information of the target type.
+    TypeInfo const *(*typeInfo)();
+    // Conversion functions, see Conversion.
+    void *(*get)(void const *value, Buffer<void> &buffer);
+    bool (*set)(Accessor const *accessor, Storage &storage, void const *value);
+    bool (*move)(Accessor const *accessor, Storage &storage, void *value);
+    void (*destruct)(void *value);
+    // Size and alignment of the target type.
+    std::size_t size;
+    std::size_t alignment;
+    // Relative cost of the conversion.
+    unsigned cost;
+};
+
+// Description of a type, including its name, base classes and conversions.
+struct StaticType {
+    // Retrieve the type information of the type.
+    TypeInfo *(*typeInfo)();
+    // Register the type for lookup as a dynamic type.
+    void (*registerDynamicType)();
+    // Name of the type, or nullptr if the type is not to be named.
+    char const *name;
+    // Base classes of the type.
+    StaticBase const *bases;
+    std::size_t baseCount;
+    // Conversions from the type to other types.
+    StaticConversion const *conversions;
+    std::size_t conversionCount;
+};
+
+//------------------------------------------------------------------------------
+//--                          Registration Functions                          --
+//------------------------------------------------------------------------------
+// Functions implementing registered information, shared by runtime and static
+// registration.
+
+// Upcast functions for base class T_Base of type T.
+template <typename T, typename T_Base>
+struct UpcastFunctions {
+    // Upcast value, which must be of type T, to the base type.
+    static void const *upcast(void const *value) {
+        T_Base const *base = static_cast<T const *>(value);
+        return base;
+    }
+};
+
+// Conversion functions for converting type T to type T_Target by
+// constructing the target from the source.
+template <typename T, typename T_Target>
+struct ConversionFunctions {
+    // Retrieve value, which must be of type T, as the target type.
+    static void *get(void const *value, Buffer<void> &buffer) {
+        return buffer.construct<T_Target>(*static_cast<T const *>(value));
+    }
+
+    // Set the accessed value in storage, which must be of the target type,
+    // by copy-assigning value, which must be of type T.
+    static bool set(Accessor const *accessor, Storage &storage,
+                    void const *value) {
+        T_Target target = *static_cast<T const *>(value);
+        return accessor->move(storage, &target);
+    }
+
+    // Set the accessed value in storage, which must be of the target type,
+    // by move-assigning value, which must be of type T.
+    static bool move(Accessor const *accessor, Storage &storage,
+                     void *value) {
+        T_Target target = std::move(*static_cast<T *>(value));
+        return accessor->move(storage, &target);
+    }
+
+    // Destruct value, which must be of the target type.
+    static void destruct(void *value) {
+        static_cast<T_Target *>(value)->~T_Target();
+    }
+};
+
+} }
+//--                      End Namespace Reflect::Detail                       --
+//------------------------------------------------------------------------------
+
+#endif
@@ -4,6 +4,8 @@
 #ifndef REFLECT_DETAIL_TRAITS_H
 #define REFLECT_DETAIL_TRAITS_H
 
+// std::size_t
+#include <cstddef>
 #include <type_traits>
 
 //------------------------------------------------------------------------------
@@ -116,6 +118,46 @@ using DefaultReturnType = typename std::conditional<
     std::add_lvalue_reference<T>
 >::type::type;
 
+// Compile-time sequence of indices, similar to C++14's std::index_sequence.
+template <std::size_t ...indices>
+struct IndexSequence { };
+
+template <std::size_t count, std::size_t ...indices>
+struct MakeIndexSequenceImpl
+: MakeIndexSequenceImpl<count - 1, count - 1, indices...> { };
+
+template <std::size_t ...indices>
+struct MakeIndexSequenceImpl<0, indices...> {
+    using type = IndexSequence<indices...>;
+};
+
+template <std::size_t count>
+using MakeIndexSequence = typename MakeIndexSequenceImpl<count>::type;
+
+// Determines the result and parameter type of a callable taking a single
+// parameter, i.e., a function, function pointer or non-generic function
+// object.
+template <typename T>
+struct CallableTraits : CallableTraits<decltype(&T::operator())> { };
+
+template <typename T_Result, typename T_Parameter>
+struct CallableTraits<T_Result (T_Parameter)> {
+    using Result = T_Result;
+    using Parameter = T_Parameter;
+};
+
+template <typename T_Result, typename T_Parameter>
+struct CallableTraits<T_Result (*)(T_Parameter)>
+: CallableTraits<T_Result (T_Parameter)> { };
+
+template <typename T_Class, typename T_Result, typename T_Parameter>
+struct CallableTraits<T_Result (T_Class::*)(T_Parameter)>
+: CallableTraits<T_Result (T_Parameter)> { };
+
+template <typename T_Class, typename T_Result, typename T_Parameter>
+struct CallableTraits<T_Result (T_Class::*)(T_Parameter) const>
+: CallableTraits<T_Result (T_Parameter)> { };
+
 } }
 //--                      End Namespace Reflect::Detail                       --
 //------------------------------------------------------------------------------
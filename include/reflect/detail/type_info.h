@@ -5,6 +5,7 @@
 #define REFLECT_DETAIL_TYPEINFO_H
 
 #include "base.h"
+#include "config.h"
 //#include "constant.h"
 //#include "constructor.h"
 #include "conversion.h"
@@ -13,20 +14,40 @@
 //#include "property.h"
 
 #include "iterator_range.h"
+#include "name_registry.h"
 
+// std::atomic
+#include <atomic>
+// std::size_t
+#include <cstddef>
+// std::uint64_t
+#include <cstdint>
 #include <string>
-#include <typeinfo>
 #include <type_traits>
+// std::move
+#include <utility>
 #include <vector>
 
+#if !defined(REFLECT_NO_RTTI)
+#include <typeinfo>
+#endif
+
 //------------------------------------------------------------------------------
 //--                     Begin Namespace Reflect::Detail                      --
 namespace Reflect { namespace Detail {
 
+// Uses.
+struct StaticType;
+
 //------------------------------------------------------------------------------
 //--                              Class TypeInfo                              --
 //------------------------------------------------------------------------------
 // Contains all registered information for a type.
+// Registered information may be retrieved concurrently with registration.
+// Registration publishes a new, immutable snapshot of the type's information,
+// so that retrieval never blocks, while registration is serialized globally.
+// Registration may also be deferred until information about the type is first
+// retrieved, in which case the first retrieval executes the registration.
 class TypeInfo {
 public:
     // Retrieve the global type information instance of type T.
@@ -38,39 +59,76 @@ public:
 //-----------------------------  Public Interface  -----------------------------
 public:
     // Retrieve the shortest name by which the type has been registered.
-    std::string const &getName() const { return _name; }
+    std::string const &getName() const {
+        runDeferred();
+        return *_name.load(std::memory_order_acquire);
+    }
+
+    // Retrieve the hash of the first name by which the type has been
+    // registered, or of the implementation-defined name if the type has not
+    // been registered with a name. The hash of a registered name is identical
+    // across processes and builds.
+    std::uint64_t getHash() const {
+        runDeferred();
+        return _hash.load(std::memory_order_acquire);
+    }
+
+//----------------------------------  Layout  ----------------------------------
+public:
+    // Layout properties of a type, which are determined at compile time.
+    struct Layout {
+        // Size and alignment of the type, or zero for void.
+        std::size_t size;
+        std::size_t alignment;
+        // Type properties as determined by the corresponding type traits.
+        bool triviallyCopyable;
+        bool triviallyDestructible;
+        bool standardLayout;
+    };
+
+    // Retrieve the layout properties of the type.
+    Layout const &getLayout() const { return _layout; }
 
 //-------------------------------  Base Classes  -------------------------------
 public:
     // Iterate over all registered base classes of the type.
-    using BaseIterator = std::vector<Base>::const_iterator;
+    // Only getBases is guaranteed to produce a consistent range if base
+    // classes are registered concurrently.
+    using BaseIterator = Base const *;
     IteratorRange<BaseIterator> getBases() const {
-        return { beginBases(), endBases() };
+        Entries const *entries = getEntries();
+        return { entries->basesBegin, entries->basesEnd };
     }
     BaseIterator beginBases() const {
-        return _bases.begin();
+        return getEntries()->basesBegin;
     }
     BaseIterator endBases() const {
-        return _bases.end();
+        return getEntries()->basesEnd;
     }
 
 //-------------------------------  Conversions  --------------------------------
 public:
     // Iterate over all registered conversions from the type to other types.
-    using ConversionIterator = std::vector<Conversion>::const_iterator;
+    // Only getConversions is guaranteed to produce a consistent range if
+    // conversions are registered concurrently.
+    using ConversionIterator = Conversion const *;
     IteratorRange<ConversionIterator> getConversions() const {
-        return { beginConversions(), endConversions() };
+        Entries const *entries = getEntries();
+        return { entries->conversionsBegin, entries->conversionsEnd };
     }
     ConversionIterator beginConversions() const {
-        return _conversions.begin();
+        return getEntries()->conversionsBegin;
     }
     ConversionIterator endConversions() const {
-        return _conversions.end();
+        return getEntries()->conversionsEnd;
     }
 
 //-------------------------------  Registration  -------------------------------
 public:
     // Retrieve the global type information instance of type T.
+    // The instance is shared by all shared libraries of the process, even if
+    // they do not share function-local statics, e.g., due to hidden symbol
+    // visibility.
     template <typename T>
     static TypeInfo *mutableInstance() {
         static_assert(
@@ -78,47 +136,215 @@ public:
             "Internal error: Type information instance must be decayed."
         );
 
-        static TypeInfo typeInfo(typeid(T));
-        return &typeInfo;
+        static TypeInfo *typeInfo = canonicalInstance(
+            typeName<T>(), layout<T>(std::is_void<T>())
+        );
+        return typeInfo;
     }
 
-    // Register a name for the type.
-    void registerName(std::string name) {
-        _name = std::move(name);
-        _nameSet = true;
-    }
+    // Register a name for the type, associating it globally with the type.
+    // Throws an exception if name has already been registered for a
+    // different type.
+    void registerName(std::string name);
+
+    // Registration deferred until information about the type is first
+    // retrieved, which must remain valid until it has been executed.
+    struct Deferred {
+        // Function executing the registration.
+        void (*registration)();
+        // Next deferred registration of the same type.
+        Deferred *next;
+    };
+
+    // Defer the specified registration until information about the type is
+    // first retrieved. Deferred registrations of a type are executed in the
+    // order in which they were deferred.
+    void registerDeferred(Deferred &deferred);
+
+    // Register the information described by the specified array of types,
+    // each of which may appear only once. The base classes and conversions
+    // of all types are placed in a single block of memory.
+    // Throws an exception if a name has already been registered for a
+    // different type, in which case no base classes or conversions are
+    // registered.
+    static void registerStatic(StaticType const *types, std::size_t count);
 
     // Register a base class for the type.
-    void registerBase(Base base) {
-        _bases.push_back(std::move(base));
-    }
+    void registerBase(Base base);
 
     // Register a conversion from the type to another.
-    void registerConversion(Conversion conversion) {
-        _conversions.push_back(std::move(conversion));
+    void registerConversion(Conversion conversion);
+
+    // Retrieve the generation of registered base classes and conversions,
+    // which changes whenever a base class or conversion is registered for any
+    // type. Information derived from the registered type graph remains valid
+    // so long as the generation does not change.
+    static unsigned long getGeneration() {
+        return generation().load(std::memory_order_acquire);
+    }
+
+    // Compact the registered base classes and conversions of all types into
+    // a single contiguous, cache-line aligned block of memory. Subsequent
+    // registration for a type moves its information out of the compacted
+    // block again, until the registry is frozen anew.
+    static void freeze();
+
+    // Returns true if the registry has been frozen and nothing has been
+    // registered since.
+    static bool isFrozen() {
+        return frozen().load(std::memory_order_acquire);
     }
 
+    // Retrieve all types for which base classes or conversions have been
+    // registered, in the order in which they were first registered.
+    static std::vector<TypeInfo const *> getRegisteredTypes();
+
 //----------------------------  Private Interface  -----------------------------
 private:
     // Allow creation of type information only through TypeInfo::instance.
     TypeInfo(TypeInfo const &) = delete;
 
-    TypeInfo(std::type_info const &typeInfo)
-    : _name(typeInfo.name()), _nameSet(false) { }
+    TypeInfo(std::string name, Layout const &layout)
+    : _layout(layout)
+    , _entries(&noEntries())
+    , _deferredPending(false)
+    , _deferred(nullptr)
+    , _deferredRunning(false)
+    , _typeName(std::move(name))
+    , _name(&_typeName)
+    , _hash(hashName(_typeName.data(), _typeName.size())) { }
+
+    // Retrieve the process-wide type information instance of the type with
+    // the specified implementation-defined name, creating it if necessary.
+    // Types whose names do not identify them uniquely within the process,
+    // such as types within anonymous namespaces, receive an instance of their
+    // own.
+    static TypeInfo *canonicalInstance(std::string name, Layout const &layout);
+
+    // Determine the implementation-defined name of type T.
+    template <typename T>
+    static std::string typeName() {
+#if defined(REFLECT_NO_RTTI)
+        return extractTypeName(signature<T>());
+#else
+        return typeid(T).name();
+#endif
+    }
+
+#if defined(REFLECT_NO_RTTI)
+    // Retrieve the signature of this function as provided by the compiler,
+    // which contains the name of type T.
+    template <typename T>
+    static char const *signature() {
+#if defined(_MSC_VER)
+        return __FUNCSIG__;
+#else
+        return __PRETTY_FUNCTION__;
+#endif
+    }
+
+    // Extract the name of type T from the signature of signature<T>.
+    static std::string extractTypeName(char const *signature);
+#endif
+
+    // Determine the layout properties of type T.
+    template <typename T>
+    static constexpr Layout layout(std::false_type) {
+        return {
+            sizeof(T),
+            alignof(T),
+            std::is_trivially_copyable<T>::value,
+            std::is_trivially_destructible<T>::value,
+            std::is_standard_layout<T>::value
+        };
+    }
+
+    // Determine the layout properties of void.
+    template <typename T>
+    static constexpr Layout layout(std::true_type) {
+        return { 0, 0, false, false, false };
+    }
+
+    // Execute any deferred registrations of the type.
+    void runDeferred() const {
+        if(_deferredPending.load(std::memory_order_acquire)) {
+            executeDeferred();
+        }
+    }
+
+    // Execute deferred registrations, blocking until any concurrent
+    // execution has finished.
+    void executeDeferred() const;
+
+    // Immutable snapshot of the base classes and conversions registered for
+    // a type.
+    struct Entries {
+        Base const *basesBegin;
+        Base const *basesEnd;
+        Conversion const *conversionsBegin;
+        Conversion const *conversionsEnd;
+    };
+
+    // Retrieve the current snapshot of the type, executing any deferred
+    // registrations first.
+    Entries const *getEntries() const {
+        runDeferred();
+        return _entries.load(std::memory_order_acquire);
+    }
+
+    // Snapshot of a type for which nothing has been registered.
+    static Entries const &noEntries() {
+        static Entries const entries = { nullptr, nullptr, nullptr, nullptr };
+        return entries;
+    }
+
+    // Register a name for the type. Must be called with registration
+    // serialized.
+    void internName(char const *name, std::size_t size);
+
+    // Publish a new snapshot of the type containing the current base classes
+    // and conversions, as well as the specified base class and conversion,
+    // if any. Must be called with registration serialized.
+    void publish(Base const *base, Conversion const *conversion);
+
+    // Global generation of registered base classes and conversions.
+    static std::atomic<unsigned long> &generation() {
+        static std::atomic<unsigned long> generation(0);
+        return generation;
+    }
+
+    // Global flag indicating whether the registry has been frozen.
+    static std::atomic<bool> &frozen() {
+        static std::atomic<bool> frozen(false);
+        return frozen;
+    }
 
 //-----------------------------  Private Members  ------------------------------
 private:
-    // Shortest name by which the type has been registered.
-    std::string _name;
-    bool _nameSet;
-    // List of base classes registered for the type.
-    std::vector<Base> _bases;
+    // Layout properties of the type.
+    Layout const _layout;
+    // Current snapshot of the base classes and conversions registered for
+    // the type. Snapshots are never released, so that they remain valid for
+    // concurrent readers.
+    std::atomic<Entries const *> _entries;
+    // True while deferred registrations are waiting to be executed.
+    mutable std::atomic<bool> _deferredPending;
+    // Deferred registrations in reverse order, and whether they are being
+    // executed, guarded by the deferred registration mutex.
+    mutable Deferred *_deferred;
+    mutable bool _deferredRunning;
+    // Implementation-defined name of the type.
+    std::string const _typeName;
+    // Shortest name by which the type has been registered, which is either
+    // the implementation-defined name or interned by the name registry.
+    std::atomic<std::string const *> _name;
+    // Hash of the first name by which the type has been registered, which
+    // does not change once the type has been registered with a name.
+    std::atomic<std::uint64_t> _hash;
 //    // List of constants registered for the type.
 //    std::vector<Constant> _constants;
 //    // List of constructors registered for the type.
 //    std::vector<Constructor> _constructors;
-    // List of conversions registered for the type.
-    std::vector<Conversion> _conversions;
 //    // List of extensions registered for the type.
 //    std::vector<Extension> _extensions;
 //    // List of functions registered for the type.
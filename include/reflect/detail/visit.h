@@ -0,0 +1,170 @@
+// Copyright (c) 2019 Johannes Zeppenfeld
+// SPDX-License-Identifier: MIT
+
+#ifndef REFLECT_DETAIL_VISIT_H
+#define REFLECT_DETAIL_VISIT_H
+
+#include "dispatch.h"
+#include "error.h"
+#include "traits.h"
+#include "type_info.h"
+
+// std::tuple et al.
+#include <tuple>
+// std::common_type, std::decay et al.
+#include <type_traits>
+// std::forward
+#include <utility>
+
+//------------------------------------------------------------------------------
+//--                     Begin Namespace Reflect::Detail                      --
+namespace Reflect { namespace Detail {
+
+// Determines whether values of type T_Object can be visited, i.e., whether
+// T_Object is an unqualified Reflect::Object.
+template <typename T_Object>
+struct IsVisitable : IsReflected<T_Object> { };
+
+// Determines whether a reference to type T can be retrieved from the value
+// contained in an object of unqualified type T_Object.
+template <typename T_Object, typename T>
+struct IsReferenceable : IsRelated<T, typename T_Object::element_type> { };
+
+// Determine the common result type of the specified visitors.
+template <typename ...T_Visitors>
+using VisitResult = typename std::common_type<
+    typename CallableTraits<typename std::decay<T_Visitors>::type>::Result...
+>::type;
+
+//------------------------------------------------------------------------------
+//--                               Class Visit                                --
+//------------------------------------------------------------------------------
+// Dispatches the value contained in an object of type T_Object, which must be
+// a possibly constant visitable type, to the best matching visitor.
+template <typename T_Object, typename ...T_Visitors>
+class Visit {
+    static_assert(sizeof...(T_Visitors) > 0,
+                  "At least one visitor must be specified.");
+
+public:
+    using Result = VisitResult<T_Visitors...>;
+    using Visitors = std::tuple<T_Visitors &&...>;
+
+    // Call the visitor best matching the reflected type of object.
+    static Result visit(T_Object &object, Visitors &visitors) {
+        return visit(object, visitors,
+                     MakeIndexSequence<sizeof...(T_Visitors)>());
+    }
+
+//----------------------------  Private Interface  -----------------------------
+private:
+    using Unqualified = typename std::remove_const<T_Object>::type;
+    using Invoker = Result (*)(T_Object &object, Visitors &visitors);
+
+    // Type of the visitor at index.
+    template <std::size_t index>
+    using Visitor = typename std::tuple_element<
+        index, std::tuple<T_Visitors...>
+    >::type;
+
+    // Determines how the visitor at index can be passed the contained value.
+    template <std::size_t index>
+    struct Parameter {
+        using Type = typename CallableTraits<
+            typename std::decay<Visitor<index>>::type
+        >::Parameter;
+        using Decayed = typename std::decay<Type>::type;
+
+        // The parameter is a mutable lvalue reference.
+        static constexpr bool mutableReference =
+            std::is_lvalue_reference<Type>::value &&
+            !std::is_const<typename std::remove_reference<Type>::type>::value;
+
+        // The parameter can bind to a reference to the contained value.
+        static constexpr bool byReference =
+            std::is_lvalue_reference<Type>::value &&
+            IsReferenceable<Unqualified, Decayed>::value &&
+            !(mutableReference && std::is_const<T_Object>::value);
+
+        // The parameter can bind to a copy or conversion of the contained
+        // value.
+        static constexpr bool byValue = !mutableReference;
+    };
+
+    // Invoke the visitor at index with a reference to the contained value.
+    template <std::size_t index,
+              bool enabled = Parameter<index>::byReference>
+    struct ReferenceInvoker {
+        static Result invoke(T_Object &object, Visitors &visitors) {
+            return std::forward<Visitor<index>>(std::get<index>(visitors))(
+                object.template get<typename Parameter<index>::Type>()
+            );
+        }
+
+        static Invoker get() { return &invoke; }
+    };
+
+    template <std::size_t index>
+    struct ReferenceInvoker<index, false> {
+        static Invoker get() { return nullptr; }
+    };
+
+    // Invoke the visitor at index with a copy or conversion of the contained
+    // value.
+    template <std::size_t index,
+              bool enabled = Parameter<index>::byValue>
+    struct ValueInvoker {
+        static Result invoke(T_Object &object, Visitors &visitors) {
+            return std::forward<Visitor<index>>(std::get<index>(visitors))(
+                object.template get<typename Parameter<index>::Decayed>()
+            );
+        }
+
+        static Invoker get() { return &invoke; }
+    };
+
+    template <std::size_t index>
+    struct ValueInvoker<index, false> {
+        static Invoker get() { return nullptr; }
+    };
+
+    // Call the visitor best matching the reflected type of object.
+    template <std::size_t ...indices>
+    static Result visit(T_Object &object, Visitors &visitors,
+                        IndexSequence<indices...>) {
+        // Candidates and their invokers are built once per set of visitors.
+        static DispatchTable const table {
+            {
+                TypeInfo::instance<typename Parameter<indices>::Decayed>(),
+                Parameter<indices>::byReference,
+                Parameter<indices>::mutableReference,
+                Parameter<indices>::byValue
+            }...
+        };
+        static Invoker const referenceInvokers[] = {
+            ReferenceInvoker<indices>::get()...
+        };
+        static Invoker const valueInvokers[] = {
+            ValueInvoker<indices>::get()...
+        };
+
+        auto type = object.getType();
+        DispatchTable::Entry const *entry = table.find(type);
+        if(!entry) {
+            raiseError(
+                "Could not visit type '" + type.getName()
+                + "' with any of the specified visitors."
+            );
+        }
+
+        Invoker invoker = entry->byValue ? valueInvokers[entry->index]
+                                         : referenceInvokers[entry->index];
+        return invoker(object, visitors);
+    }
+};
+
+} }
+//--                      End Namespace Reflect::Detail                       --
+//------------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,39 @@
+// Copyright (c) 2019 Johannes Zeppenfeld
+// SPDX-License-Identifier: MIT
+
+#ifndef REFLECT_ERROR_H
+#define REFLECT_ERROR_H
+
+#include "detail/config.h"
+
+#include <string>
+
+//------------------------------------------------------------------------------
+//--                         Begin Namespace Reflect                          --
+namespace Reflect {
+
+//------------------------------------------------------------------------------
+//--                              Error Handling                              --
+//------------------------------------------------------------------------------
+// Errors, such as failing to retrieve a value as a requested type, are
+// reported by calling the installed error handler with a description of the
+// error. If no handler is installed or the handler returns, a
+// std::runtime_error is thrown, or, if the library has been built with
+// REFLECT_NO_EXCEPTIONS, the description is written to stderr and the program
+// is aborted.
+// A handler may instead throw an exception of its own, or terminate the
+// program in an application-specific manner.
+using ErrorHandler = void (*)(std::string const &message);
+
+// Install the error handler, which may be nullptr to restore the default
+// behavior. Returns the previously installed error handler.
+ErrorHandler setErrorHandler(ErrorHandler handler);
+
+// Retrieve the currently installed error handler.
+ErrorHandler getErrorHandler();
+
+}
+//--                          End Namespace Reflect                           --
+//------------------------------------------------------------------------------
+
+#endif
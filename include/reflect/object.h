@@ -16,6 +16,8 @@ namespace Reflect {
 
 // Uses.
 namespace Detail { class Accessor; }
+namespace Detail { template <typename T> class DynamicReference; }
+class Binding;
 class Type;
 
 //------------------------------------------------------------------------------
@@ -45,7 +47,12 @@ public:
             Detail::IsDerived<T_Derived, T>::value &&
             std::is_constructible<T_Derived, T_Derived>::value &&
             !Detail::IsReflected<T_Derived>::value &&
-            !Detail::IsSameTemplate<T_Derived, std::reference_wrapper<T>>::value
+            !Detail::IsSameTemplate<
+                T_Derived, std::reference_wrapper<T>
+            >::value &&
+            !Detail::IsSameTemplate<
+                T_Derived, Detail::DynamicReference<T>
+            >::value
         > = Detail::EnableIfType::Enabled
     >
     Object(T_Derived &&other);
@@ -91,6 +98,19 @@ public:
     >
     Object(std::reference_wrapper<T_Derived> &&other);
 
+    // Construct object referencing the value of other.
+    // The reflected type of the object will be the most-derived registered
+    // type of the referenced value, so long as it is polymorphic and derives
+    // from T_Derived through registered base classes, and T_Derived otherwise.
+    template <
+        typename T_Derived,
+        Detail::EnableIf<
+            Detail::IsDerived<T_Derived, T>::value &&
+            !Detail::IsReflected<T_Derived>::value
+        > = Detail::EnableIfType::Enabled
+    >
+    Object(Detail::DynamicReference<T_Derived> &&other);
+
     // Construct object referencing the other object's reflected value.
     // The reflected type of the object will be equivalent to that of other.
     // Throws an exception if the other object's value is not derived from T.
@@ -169,6 +189,28 @@ public:
     >
     T_Return get() const;
 
+    // Retrieve a pointer to the contained value as type T_Value, which may be
+    // constant-qualified, without raising an error.
+    // Returns nullptr if the contained value cannot be referenced as type
+    // T_Value, or is constant and T_Value is not.
+    template <
+        typename T_Value,
+        Detail::EnableIf<
+            Detail::IsRelated<T_Value, T>::value &&
+            !std::is_reference<T_Value>::value
+        > = Detail::EnableIfType::Enabled
+    >
+    T_Value *tryGet();
+
+    template <
+        typename T_Value,
+        Detail::EnableIf<
+            Detail::IsRelated<T_Value, T>::value &&
+            !std::is_reference<T_Value>::value
+        > = Detail::EnableIfType::Enabled
+    >
+    T_Value const *tryGet() const;
+
     // Set the contained value without changing its reflected type.
     // Throws an exception if the contained value is constant or cannot be set
     // from type T_Value.
@@ -206,6 +248,18 @@ public:
     >
     void set(T_Reflected<T_Value> &&value);
 
+    // Set the contained value without changing its reflected type, without
+    // raising an error.
+    // Returns false if the contained value is constant or cannot be set from
+    // type T_Value.
+    template <
+        typename T_Value,
+        Detail::EnableIf<
+            !Detail::IsReflected<T_Value>::value
+        > = Detail::EnableIfType::Enabled
+    >
+    bool trySet(T_Value &&value);
+
 //-----------------------------  Type Reflection  ------------------------------
 public:
     // Retrieve the qualified reflected type of the contained value.
@@ -222,15 +276,58 @@ public:
     // the object.
     bool isReference() const;
 
+//----------------------------  Private Interface  -----------------------------
+private:
+    // Throw an exception unless the reflected type of the value accessed by
+    // accessor is derived from T. Values of type T_Related are only verified
+    // if T_Related is not derived from T.
+    template <typename T_Related>
+    static void verifyDerived(Detail::Accessor const *accessor);
+
 //-----------------------------  Private Members  ------------------------------
 private:
     template <typename T_Other>
     friend class Object;
+    friend class Binding;
 
     Detail::Storage _storage;
     Detail::Accessor const *_accessor;
 };
 
+//---------------------------  Non-Member Functions  ---------------------------
+
+// Create a dynamic reference to value, from which an object referencing value
+// can be constructed. The reflected type of such an object will be the
+// most-derived registered type of value rather than T.
+template <typename T>
+Detail::DynamicReference<T> dynamicRef(T &value);
+
+template <typename T>
+Detail::DynamicReference<T const> dynamicCref(T const &value);
+
+// Create an object of type T_Target referencing the value of obj, without
+// copying it. The reflected type of the created object will be equivalent to
+// that of obj.
+// Throws an exception if the reflected type of obj is not derived from
+// T_Target, which is verified in constant time.
+template <
+    typename T_Target,
+    typename T_Source,
+    Detail::EnableIf<
+        Detail::IsRelated<T_Source, T_Target>::value
+    > = Detail::EnableIfType::Enabled
+>
+Object<T_Target> objectCast(Object<T_Source> &obj);
+
+template <
+    typename T_Target,
+    typename T_Source,
+    Detail::EnableIf<
+        Detail::IsRelated<T_Source, T_Target>::value
+    > = Detail::EnableIfType::Enabled
+>
+Object<T_Target> objectCast(Object<T_Source> const &obj);
+
 }
 //--                          End Namespace Reflect                           --
 //------------------------------------------------------------------------------
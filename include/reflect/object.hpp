@@ -4,6 +4,8 @@
 #include "type.h"
 
 #include "detail/buffer.h"
+#include "detail/dynamic_type.h"
+#include "detail/hierarchy.h"
 #include "detail/type_info.h"
 #include "detail/value_accessor.h"
 
@@ -24,7 +26,12 @@ template <
         Detail::IsDerived<T_Derived, T>::value &&
         std::is_constructible<T_Derived, T_Derived>::value &&
         !Detail::IsReflected<T_Derived>::value &&
-        !Detail::IsSameTemplate<T_Derived, std::reference_wrapper<T>>::value
+        !Detail::IsSameTemplate<
+            T_Derived, std::reference_wrapper<T>
+        >::value &&
+        !Detail::IsSameTemplate<
+            T_Derived, Detail::DynamicReference<T>
+        >::value
     >
 >
 Object<T>::Object(T_Derived &&other) {
@@ -59,7 +66,7 @@ template <
     >
 >
 Object<T>::Object(Object<T_Related> const &other) {
-    // TODO: Verify that other's reflected type derives from T.
+    verifyDerived<T_Related>(other._accessor);
     _accessor = other._accessor->constructCopy(_storage, other._storage);
 }
 
@@ -74,7 +81,7 @@ template <
     >
 >
 Object<T>::Object(Object<T_Related> &&other) {
-    // TODO: Verify that other's reflected type derives from T.
+    verifyDerived<T_Related>(other._accessor);
     _accessor = other._accessor->constructMove(_storage, other._storage);
 }
 
@@ -95,6 +102,25 @@ Object<T>::Object(std::reference_wrapper<T_Derived> &&other) {
     );
 }
 
+// Construct object referencing the value of other.
+// The reflected type of the object will be the most-derived registered type of
+// the referenced value.
+template <typename T>
+template <
+    typename T_Derived,
+    Detail::EnableIf<
+        Detail::IsDerived<T_Derived, T>::value &&
+        !Detail::IsReflected<T_Derived>::value
+    >
+>
+Object<T>::Object(Detail::DynamicReference<T_Derived> &&other) {
+    using T_Decomposed = Detail::Decompose<T_Derived>;
+    _accessor = Detail::constructDynamicReference<T_Decomposed>(
+        _storage, other.get(),
+        std::is_polymorphic<T_Decomposed>()
+    );
+}
+
 // Construct object referencing the other object's reflected value.
 // The reflected type of the object will be equivalent to that of other.
 // Throws an exception if other's reflected type is not derived from T.
@@ -108,7 +134,7 @@ template <
     >
 >
 Object<T>::Object(std::reference_wrapper<T_Reflected<T_Related>> &&other) {
-    // TODO: Verify that other's reflected type derives from T.
+    verifyDerived<T_Related>(other.get()._accessor);
     _accessor = other.get()._accessor->constructReference(
         _storage, other.get()._storage, false
     );
@@ -126,7 +152,7 @@ template <
 Object<T>::Object(
     std::reference_wrapper<T_Reflected<T_Related> const> &&other
 ) {
-    // TODO: Verify that other's reflected type derives from T.
+    verifyDerived<T_Related>(other.get()._accessor);
     _accessor = other.get()._accessor->constructReference(
         _storage, other.get()._storage, true
     );
@@ -249,6 +275,49 @@ T_Return Object<T>::get() const {
                      _storage);
 }
 
+// Retrieve a pointer to the contained value as type T_Value without raising
+// an error.
+template <typename T>
+template <
+    typename T_Value,
+    Detail::EnableIf<
+        Detail::IsRelated<T_Value, T>::value &&
+        !std::is_reference<T_Value>::value
+    >
+>
+T_Value *Object<T>::tryGet() {
+    using T_Decayed = typename std::remove_const<T_Value>::type;
+
+    // Retrieve by constant reference only if T_Value is constant, so that the
+    // value is only referenced mutably if it is not constant.
+    void const *value = std::is_const<T_Value>::value
+        ? _accessor->tryGetAsConst(
+              _storage, Detail::TypeInfo::instance<T_Decayed>()
+          )
+        : _accessor->tryGetAs(
+              _storage, Detail::TypeInfo::instance<T_Decayed>()
+          );
+    return static_cast<T_Value *>(const_cast<void *>(value));
+}
+
+template <typename T>
+template <
+    typename T_Value,
+    Detail::EnableIf<
+        Detail::IsRelated<T_Value, T>::value &&
+        !std::is_reference<T_Value>::value
+    >
+>
+T_Value const *Object<T>::tryGet() const {
+    using T_Decayed = typename std::remove_const<T_Value>::type;
+
+    return static_cast<T_Value const *>(
+        _accessor->tryGetAsConst(
+            _storage, Detail::TypeInfo::instance<T_Decayed>()
+        )
+    );
+}
+
 // Set the contained value without changing its reflected type.
 // Throws an exception if the contained value is constant or cannot be set
 // from type T_Value.
@@ -325,6 +394,47 @@ void Object<T>::set(T_Reflected<T_Value> &&value) {
     _accessor->moveAs(_storage, value._accessor, value._storage);
 }
 
+// Set the contained value without changing its reflected type, without
+// raising an error.
+template <typename T>
+template <
+    typename T_Value,
+    Detail::EnableIf<
+        !Detail::IsReflected<T_Value>::value
+    >
+>
+bool Object<T>::trySet(T_Value &&value) {
+    using T_Decayed = typename std::decay<T_Value>::type;
+
+    struct Impl {
+        // Copy-assign value to storage using the accessor.
+        static bool set(std::true_type,
+                        Detail::Accessor const *accessor,
+                        Detail::Storage &storage,
+                        T_Decayed const &value) {
+            return accessor->trySetAs(storage,
+                                      Detail::TypeInfo::instance<T_Decayed>(),
+                                      &value);
+        }
+
+        // Move-assign value to storage using the accessor.
+        static bool set(std::false_type,
+                        Detail::Accessor const *accessor,
+                        Detail::Storage &storage,
+                        T_Decayed &value) {
+            return accessor->tryMoveAs(storage,
+                                       Detail::TypeInfo::instance<T_Decayed>(),
+                                       &value);
+        }
+    };
+
+    // Copy or move value depending on whether it is a reference.
+    return Impl::set(std::is_lvalue_reference<T_Value>(),
+                     _accessor,
+                     _storage,
+                     value);
+}
+
 //-----------------------------  Type Reflection  ------------------------------
 
 // Retrieve the qualified reflected type of the contained value.
@@ -359,6 +469,55 @@ bool Object<T>::isReference() const {
     return _accessor->isReference();
 }
 
+//----------------------------  Private Interface  -----------------------------
+
+// Throw an exception unless the reflected type of the value accessed by
+// accessor is derived from T.
+template <typename T>
+template <typename T_Related>
+void Object<T>::verifyDerived(Detail::Accessor const *accessor) {
+    if(!Detail::IsDerived<T_Related, T>::value) {
+        Detail::verifyDerived(accessor->getTypeInfo(),
+                              Detail::TypeInfo::instance<T>());
+    }
+}
+
+//---------------------------  Non-Member Functions  ---------------------------
+
+// Create a dynamic reference to value.
+template <typename T>
+Detail::DynamicReference<T> dynamicRef(T &value) {
+    return Detail::DynamicReference<T>(value);
+}
+
+template <typename T>
+Detail::DynamicReference<T const> dynamicCref(T const &value) {
+    return Detail::DynamicReference<T const>(value);
+}
+
+// Create an object of type T_Target referencing the value of obj.
+template <
+    typename T_Target,
+    typename T_Source,
+    Detail::EnableIf<
+        Detail::IsRelated<T_Source, T_Target>::value
+    >
+>
+Object<T_Target> objectCast(Object<T_Source> &obj) {
+    return std::ref(obj);
+}
+
+template <
+    typename T_Target,
+    typename T_Source,
+    Detail::EnableIf<
+        Detail::IsRelated<T_Source, T_Target>::value
+    >
+>
+Object<T_Target> objectCast(Object<T_Source> const &obj) {
+    return std::cref(obj);
+}
+
 }
 //--                          End Namespace Reflect                           --
 //------------------------------------------------------------------------------
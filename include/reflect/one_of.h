@@ -0,0 +1,245 @@
+// Copyright (c) 2019 Johannes Zeppenfeld
+// SPDX-License-Identifier: MIT
+
+#ifndef REFLECT_ONEOF_H
+#define REFLECT_ONEOF_H
+
+#include "object.h"
+
+#include "detail/alternatives.h"
+#include "detail/traits.h"
+#include "detail/visit.h"
+
+// std::size_t
+#include <cstddef>
+// std::aligned_storage et al.
+#include <type_traits>
+
+//------------------------------------------------------------------------------
+//--                         Begin Namespace Reflect                          --
+namespace Reflect {
+
+// Uses.
+class Type;
+
+//------------------------------------------------------------------------------
+//--                               Class OneOf                                --
+//------------------------------------------------------------------------------
+// This class provides reflection access to a contained value whose type is one
+// of the alternatives Ts. The contained value is always owned by the object
+// and stored inline, without any dynamic allocation, and operations on it are
+// dispatched over the index of the contained alternative rather than through
+// a type-erased accessor.
+// The contained value can be retrieved and set as any type reachable through
+// registered base classes and conversions, just as for Object.
+template <typename ...Ts>
+class OneOf {
+    using Alternatives = Detail::Alternatives<Ts...>;
+
+public:
+    static_assert(sizeof...(Ts) > 0 && sizeof...(Ts) < 256,
+                  "OneOf must have between 1 and 255 alternatives.");
+    static_assert(Alternatives::decayed,
+                  "OneOf alternatives must be decayed types.");
+    static_assert(Alternatives::unique,
+                  "OneOf alternatives must be unique.");
+
+public:
+    // Construct object containing a default-constructed instance of the first
+    // alternative.
+    OneOf();
+
+    // Construct object containing a copy of value, or value's moved value.
+    // The contained alternative will be the decayed type of value.
+    template <
+        typename T_Value,
+        Detail::EnableIf<
+            Detail::IsAlternative<T_Value, Ts...>::value
+        > = Detail::EnableIfType::Enabled
+    >
+    OneOf(T_Value &&value);
+
+    // Construct object containing the value of a reflected object as the
+    // alternative best matching the reflected type of other, i.e., the
+    // reflected type itself, its nearest registered base class or a type to
+    // which a conversion has been registered, in that order of preference.
+    // Throws an exception if no alternative can be constructed from other.
+    template <
+        template <typename> class T_Reflected,
+        typename T_Value,
+        Detail::EnableIf<
+            Detail::IsReflected<T_Reflected<T_Value>>::value
+        > = Detail::EnableIfType::Enabled
+    >
+    explicit OneOf(T_Reflected<T_Value> const &other);
+
+    // Construct object containing a copy of the other object's value.
+    OneOf(OneOf const &other);
+
+    // Construct object containing the other object's moved value.
+    OneOf(OneOf &&other);
+
+    // Destroy the object and its contents.
+    ~OneOf();
+
+    // Copy-assign the other object's value, changing the contained alternative
+    // if necessary.
+    OneOf &operator=(OneOf const &other);
+
+    // Move-assign the other object's value, changing the contained alternative
+    // if necessary.
+    OneOf &operator=(OneOf &&other);
+
+//-------------------------------  Value Access  -------------------------------
+public:
+    // Retrieve the contained value by mutable reference.
+    // Throws an exception if the contained value cannot be converted to type
+    // T_Return.
+    template <
+        typename T_Return,
+        Detail::EnableIf<
+            std::is_reference<T_Return>::value &&
+            !std::is_const<Detail::Decompose<T_Return>>::value
+        > = Detail::EnableIfType::Enabled
+    >
+    T_Return get();
+
+    // Retrieve the contained value by value or constant reference.
+    // Throws an exception if the contained value cannot be converted to type
+    // T_Return.
+    template <
+        typename T_Return,
+        Detail::EnableIf<
+            (!std::is_reference<T_Return>::value &&
+             !std::is_void<T_Return>::value) ||
+            std::is_const<Detail::Decompose<T_Return>>::value
+        > = Detail::EnableIfType::Enabled
+    >
+    T_Return get() const;
+
+    // Set the contained value.
+    // If the decayed type of value is one of the alternatives, it becomes the
+    // contained alternative. Otherwise, value is assigned to the contained
+    // alternative using registered base classes and conversions.
+    // Throws an exception if the contained alternative cannot be set from type
+    // T_Value.
+    template <
+        typename T_Value,
+        Detail::EnableIf<
+            !Detail::IsReflected<T_Value>::value
+        > = Detail::EnableIfType::Enabled
+    >
+    void set(T_Value &&value);
+
+    // Set the contained value from the value of a reflected object, selecting
+    // the alternative as for construction from a reflected object.
+    // Throws an exception if no alternative can be constructed from value.
+    template <
+        template <typename> class T_Reflected,
+        typename T_Value,
+        Detail::EnableIf<
+            Detail::IsReflected<T_Reflected<T_Value>>::value
+        > = Detail::EnableIfType::Enabled
+    >
+    void set(T_Reflected<T_Value> const &value);
+
+    // Retrieve an object containing a copy of the contained value.
+    // The reflected type of the object will be the contained alternative.
+    Object<> getObject() const;
+
+//-----------------------------  Type Reflection  ------------------------------
+public:
+    // Retrieve the index of alternative T, or the number of alternatives if T
+    // is not an alternative.
+    template <typename T>
+    static constexpr std::size_t indexOf() {
+        return Alternatives::template indexOf<T>();
+    }
+
+    // Retrieve the index of the contained alternative.
+    std::size_t getIndex() const { return _index; }
+
+    // Retrieve the type of the contained alternative.
+    Type getType() const;
+
+//----------------------------  Private Interface  -----------------------------
+private:
+    // Operations dispatched over the contained alternative.
+    struct Destruct;
+    struct CopyConstruct;
+    struct MoveConstruct;
+    struct CopyAssign;
+    struct MoveAssign;
+    struct ConvertAndAssign;
+    struct MakeObject;
+    template <template <typename> class T_Reflected, typename T_Value>
+    struct ConstructFrom;
+
+    // Retrieve the contained value as alternative T.
+    // Requires that T is the contained alternative.
+    template <typename T>
+    T &access() { return *reinterpret_cast<T *>(&_data); }
+    template <typename T>
+    T const &access() const { return *reinterpret_cast<T const *>(&_data); }
+
+    // Retrieve the type information of the contained alternative.
+    Detail::TypeInfo const *getTypeInfo() const;
+
+    // Construct alternative T, forwarding the provided arguments to its
+    // constructor. Requires that no alternative is currently constructed.
+    template <typename T, typename ...T_Args>
+    void emplace(T_Args &&...args);
+
+    // Replace the contained value with an instance of alternative T,
+    // forwarding the provided arguments to its constructor.
+    // If constructing the new alternative throws, the object is left holding
+    // a default-constructed instance of the first alternative.
+    template <typename T, typename ...T_Args>
+    void replace(T_Args &&...args);
+
+    // Construct the alternative best matching the reflected type of object.
+    // Requires that no alternative is currently constructed.
+    template <template <typename> class T_Reflected, typename T_Value>
+    void emplaceFrom(T_Reflected<T_Value> const &object);
+
+    // Destroy the contained value, leaving no alternative constructed.
+    void destroy();
+
+    // Construct a default instance of the first alternative after the
+    // contained value has been destroyed. Terminates if construction throws.
+    void reset() noexcept;
+
+    // Set the contained value from a value of one of the alternatives.
+    template <typename T_Value>
+    void setValue(std::true_type, T_Value &&value);
+
+    // Set the contained value from a value of any other type.
+    template <typename T_Value>
+    void setValue(std::false_type, T_Value &&value);
+
+//-----------------------------  Private Members  ------------------------------
+private:
+    // Storage for the contained alternative.
+    typename std::aligned_storage<
+        Alternatives::size, Alternatives::alignment
+    >::type _data;
+    // Index of the contained alternative.
+    unsigned char _index;
+};
+
+namespace Detail {
+    // Values contained in a OneOf can be visited, and retrieved as any type.
+    template <typename ...Ts>
+    struct IsVisitable<OneOf<Ts...>> : std::true_type { };
+
+    template <typename ...Ts, typename T>
+    struct IsReferenceable<OneOf<Ts...>, T> : std::true_type { };
+}
+
+}
+//--                          End Namespace Reflect                           --
+//------------------------------------------------------------------------------
+
+#include "one_of.hpp"
+
+#endif
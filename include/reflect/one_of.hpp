@@ -0,0 +1,490 @@
+// Copyright (c) 2019 Johannes Zeppenfeld
+// SPDX-License-Identifier: MIT
+
+#include "type.h"
+
+#include "detail/buffer.h"
+#include "detail/config.h"
+#include "detail/convert.h"
+#include "detail/dispatch.h"
+#include "detail/error.h"
+#include "detail/type_info.h"
+
+// std::runtime_error
+
+//------------------------------------------------------------------------------
+//--                         Begin Namespace Reflect                          --
+namespace Reflect {
+
+//------------------------------------------------------------------------------
+//--                               Class OneOf                                --
+//------------------------------------------------------------------------------
+
+//-------------------------  Dispatched Operations  ----------------------------
+
+// Destroy the contained value.
+template <typename ...Ts>
+struct OneOf<Ts...>::Destruct {
+    OneOf &self;
+
+    template <typename T>
+    void apply() { self.template access<T>().~T(); }
+};
+
+// Construct a copy of other's value.
+template <typename ...Ts>
+struct OneOf<Ts...>::CopyConstruct {
+    OneOf &self;
+    OneOf const &other;
+
+    template <typename T>
+    void apply() { self.template emplace<T>(other.template access<T>()); }
+};
+
+// Construct other's moved value.
+template <typename ...Ts>
+struct OneOf<Ts...>::MoveConstruct {
+    OneOf &self;
+    OneOf &other;
+
+    template <typename T>
+    void apply() {
+        self.template emplace<T>(std::move(other.template access<T>()));
+    }
+};
+
+// Copy-assign other's value, which must be of the contained alternative.
+template <typename ...Ts>
+struct OneOf<Ts...>::CopyAssign {
+    OneOf &self;
+    OneOf const &other;
+
+    template <typename T>
+    void apply() {
+        self.template access<T>() = other.template access<T>();
+    }
+};
+
+// Move-assign other's value, which must be of the contained alternative.
+template <typename ...Ts>
+struct OneOf<Ts...>::MoveAssign {
+    OneOf &self;
+    OneOf &other;
+
+    template <typename T>
+    void apply() {
+        self.template access<T>() = std::move(other.template access<T>());
+    }
+};
+
+// Convert value from the type associated with source and assign it to the
+// contained value, returning false if no conversion is registered.
+template <typename ...Ts>
+struct OneOf<Ts...>::ConvertAndAssign {
+    OneOf &self;
+    Detail::TypeInfo const *source;
+    void *value;
+    bool movable;
+
+    template <typename T>
+    bool apply() {
+        // Buffer into which a registered conversion can construct an instance
+        // of the contained alternative.
+        Detail::Buffer<T> buffer;
+
+        void *converted = Detail::convert(
+            source, value, Detail::TypeInfo::instance<T>(),
+            true, movable, &buffer
+        );
+        if(!converted) return false;
+
+        if(buffer.isConstructed() || movable) {
+            self.template access<T>() =
+                std::move(*static_cast<T *>(converted));
+        } else {
+            self.template access<T>() = *static_cast<T const *>(converted);
+        }
+        return true;
+    }
+};
+
+// Create an object containing a copy of the contained value.
+template <typename ...Ts>
+struct OneOf<Ts...>::MakeObject {
+    OneOf const &self;
+
+    template <typename T>
+    Object<> apply() { return Object<>(self.template access<T>()); }
+};
+
+// Construct an alternative from the value of a reflected object.
+template <typename ...Ts>
+template <template <typename> class T_Reflected, typename T_Value>
+struct OneOf<Ts...>::ConstructFrom {
+    OneOf &self;
+    T_Reflected<T_Value> const &object;
+    bool byValue;
+
+    template <typename T>
+    void apply() {
+        apply<T>(Detail::IsRelated<T, T_Value>());
+    }
+
+    // Construct from a constant reference to the object's value if possible.
+    template <typename T>
+    void apply(std::true_type) {
+        if(byValue) {
+            self.template emplace<T>(object.template get<T>());
+        } else {
+            self.template emplace<T>(object.template get<T const &>());
+        }
+    }
+
+    template <typename T>
+    void apply(std::false_type) {
+        self.template emplace<T>(object.template get<T>());
+    }
+};
+
+//------------------------------------------------------------------------------
+
+// Construct object containing a default-constructed instance of the first
+// alternative.
+template <typename ...Ts>
+OneOf<Ts...>::OneOf() {
+    emplace<typename Alternatives::First>();
+}
+
+// Construct object containing a copy of value, or value's moved value.
+template <typename ...Ts>
+template <
+    typename T_Value,
+    Detail::EnableIf<
+        Detail::IsAlternative<T_Value, Ts...>::value
+    >
+>
+OneOf<Ts...>::OneOf(T_Value &&value) {
+    emplace<typename std::decay<T_Value>::type>(std::forward<T_Value>(value));
+}
+
+// Construct object containing the value of a reflected object as the
+// alternative best matching the reflected type of other.
+template <typename ...Ts>
+template <
+    template <typename> class T_Reflected,
+    typename T_Value,
+    Detail::EnableIf<
+        Detail::IsReflected<T_Reflected<T_Value>>::value
+    >
+>
+OneOf<Ts...>::OneOf(T_Reflected<T_Value> const &other) {
+    emplaceFrom(other);
+}
+
+// Construct object containing a copy of the other object's value.
+template <typename ...Ts>
+OneOf<Ts...>::OneOf(OneOf const &other) {
+    CopyConstruct construct { *this, other };
+    Alternatives::template dispatch<void>(other._index, construct);
+}
+
+// Construct object containing the other object's moved value.
+template <typename ...Ts>
+OneOf<Ts...>::OneOf(OneOf &&other) {
+    MoveConstruct construct { *this, other };
+    Alternatives::template dispatch<void>(other._index, construct);
+}
+
+// Destroy the object and its contents.
+template <typename ...Ts>
+OneOf<Ts...>::~OneOf() {
+    destroy();
+}
+
+// Copy-assign the other object's value.
+template <typename ...Ts>
+OneOf<Ts...> &OneOf<Ts...>::operator=(OneOf const &other) {
+    if(_index == other._index) {
+        CopyAssign assign { *this, other };
+        Alternatives::template dispatch<void>(_index, assign);
+    } else {
+        // Copy first, so that a throwing copy leaves the contained value
+        // untouched.
+        OneOf copy(other);
+        *this = std::move(copy);
+    }
+    return *this;
+}
+
+// Move-assign the other object's value.
+template <typename ...Ts>
+OneOf<Ts...> &OneOf<Ts...>::operator=(OneOf &&other) {
+    if(_index == other._index) {
+        MoveAssign assign { *this, other };
+        Alternatives::template dispatch<void>(_index, assign);
+    } else {
+        destroy();
+        MoveConstruct construct { *this, other };
+#if defined(REFLECT_NO_EXCEPTIONS)
+        Alternatives::template dispatch<void>(other._index, construct);
+#else
+        try {
+            Alternatives::template dispatch<void>(other._index, construct);
+        } catch(...) {
+            reset();
+            throw;
+        }
+#endif
+    }
+    return *this;
+}
+
+//-------------------------------  Value Access  -------------------------------
+
+// Retrieve the contained value by mutable reference.
+template <typename ...Ts>
+template <
+    typename T_Return,
+    Detail::EnableIf<
+        std::is_reference<T_Return>::value &&
+        !std::is_const<Detail::Decompose<T_Return>>::value
+    >
+>
+T_Return OneOf<Ts...>::get() {
+    using T_Decayed = typename std::decay<T_Return>::type;
+
+    // Fast path if the contained alternative is requested.
+    if(indexOf<T_Decayed>() == _index) {
+        return access<T_Decayed>();
+    }
+
+    auto target = Detail::TypeInfo::instance<T_Decayed>();
+    void *value = Detail::convert(getTypeInfo(), &_data, target,
+                                  true, false, nullptr);
+    if(!value) {
+        Detail::raiseGetError(getTypeInfo(), false, false, target, " &");
+    }
+    return *static_cast<T_Decayed *>(value);
+}
+
+// Retrieve the contained value by value or constant reference.
+template <typename ...Ts>
+template <
+    typename T_Return,
+    Detail::EnableIf<
+        (!std::is_reference<T_Return>::value &&
+         !std::is_void<T_Return>::value) ||
+        std::is_const<Detail::Decompose<T_Return>>::value
+    >
+>
+T_Return OneOf<Ts...>::get() const {
+    using T_Decayed = typename std::decay<T_Return>::type;
+
+    struct Impl {
+        // Retrieve value by constant reference.
+        static T_Decayed const &get(std::true_type, OneOf const &self) {
+            auto target = Detail::TypeInfo::instance<T_Decayed>();
+            void const *value = Detail::convert(
+                self.getTypeInfo(), const_cast<void *>(
+                    static_cast<void const *>(&self._data)
+                ), target, true, false, nullptr
+            );
+            if(!value) {
+                Detail::raiseGetError(self.getTypeInfo(), true, false,
+                                      target, " const &");
+            }
+            return *static_cast<T_Decayed const *>(value);
+        }
+
+        // Retrieve value by value.
+        static T_Decayed get(std::false_type, OneOf const &self) {
+            // Buffer into which a registered conversion can construct an
+            // instance of the returned type.
+            Detail::Buffer<T_Decayed> buffer;
+
+            auto target = Detail::TypeInfo::instance<T_Decayed>();
+            void const *value = Detail::convert(
+                self.getTypeInfo(), const_cast<void *>(
+                    static_cast<void const *>(&self._data)
+                ), target, true, false, &buffer
+            );
+            if(!value) {
+                Detail::raiseGetError(self.getTypeInfo(), true, false,
+                                      target, "");
+            }
+            if(buffer.isConstructed()) {
+                return std::move(buffer.getValue());
+            } else {
+                return *static_cast<T_Decayed const *>(value);
+            }
+        }
+    };
+
+    // Fast path if the contained alternative is requested.
+    if(indexOf<T_Decayed>() == _index) {
+        return access<T_Decayed>();
+    }
+
+    // Retrieve by value or constant reference.
+    return Impl::get(std::is_reference<T_Return>(), *this);
+}
+
+// Set the contained value.
+template <typename ...Ts>
+template <
+    typename T_Value,
+    Detail::EnableIf<
+        !Detail::IsReflected<T_Value>::value
+    >
+>
+void OneOf<Ts...>::set(T_Value &&value) {
+    setValue(Detail::IsAlternative<T_Value, Ts...>(),
+             std::forward<T_Value>(value));
+}
+
+// Set the contained value from the value of a reflected object.
+template <typename ...Ts>
+template <
+    template <typename> class T_Reflected,
+    typename T_Value,
+    Detail::EnableIf<
+        Detail::IsReflected<T_Reflected<T_Value>>::value
+    >
+>
+void OneOf<Ts...>::set(T_Reflected<T_Value> const &value) {
+    OneOf converted(value);
+    *this = std::move(converted);
+}
+
+// Retrieve an object containing a copy of the contained value.
+template <typename ...Ts>
+Object<> OneOf<Ts...>::getObject() const {
+    MakeObject make { *this };
+    return Alternatives::template dispatch<Object<>>(_index, make);
+}
+
+//-----------------------------  Type Reflection  ------------------------------
+
+// Retrieve the type of the contained alternative.
+template <typename ...Ts>
+Type OneOf<Ts...>::getType() const {
+    return { getTypeInfo(), false, false };
+}
+
+//----------------------------  Private Interface  -----------------------------
+
+// Retrieve the type information of the contained alternative.
+template <typename ...Ts>
+Detail::TypeInfo const *OneOf<Ts...>::getTypeInfo() const {
+    static Detail::TypeInfo const *const typeInfos[] = {
+        Detail::TypeInfo::instance<Ts>()...
+    };
+    return typeInfos[_index];
+}
+
+// Construct alternative T, forwarding the provided arguments to its
+// constructor.
+template <typename ...Ts>
+template <typename T, typename ...T_Args>
+void OneOf<Ts...>::emplace(T_Args &&...args) {
+    new(&_data) T(std::forward<T_Args>(args)...);
+    _index = static_cast<unsigned char>(indexOf<T>());
+}
+
+// Replace the contained value with an instance of alternative T.
+template <typename ...Ts>
+template <typename T, typename ...T_Args>
+void OneOf<Ts...>::replace(T_Args &&...args) {
+    // Construct the new value before destroying the contained value, which
+    // the arguments may refer to.
+    T value(std::forward<T_Args>(args)...);
+    destroy();
+#if defined(REFLECT_NO_EXCEPTIONS)
+    emplace<T>(std::move(value));
+#else
+    try {
+        emplace<T>(std::move(value));
+    } catch(...) {
+        reset();
+        throw;
+    }
+#endif
+}
+
+// Construct the alternative best matching the reflected type of object.
+template <typename ...Ts>
+template <template <typename> class T_Reflected, typename T_Value>
+void OneOf<Ts...>::emplaceFrom(T_Reflected<T_Value> const &object) {
+    // Alternatives are selected as for visitors taking constant references.
+    static Detail::DispatchTable const table {
+        {
+            Detail::TypeInfo::instance<Ts>(),
+            Detail::IsRelated<Ts, T_Value>::value,
+            false,
+            true
+        }...
+    };
+
+    auto type = object.getType();
+    Detail::DispatchTable::Entry const *entry = table.find(type);
+    if(!entry) {
+        Detail::raiseError(
+            "Could not construct any alternative from type '"
+            + type.getName() + "'."
+        );
+    }
+
+    ConstructFrom<T_Reflected, T_Value> construct {
+        *this, object, entry->byValue
+    };
+    Alternatives::template dispatch<void>(entry->index, construct);
+}
+
+// Destroy the contained value.
+template <typename ...Ts>
+void OneOf<Ts...>::destroy() {
+    Destruct destruct { *this };
+    Alternatives::template dispatch<void>(_index, destruct);
+}
+
+// Construct a default instance of the first alternative.
+template <typename ...Ts>
+void OneOf<Ts...>::reset() noexcept {
+    emplace<typename Alternatives::First>();
+}
+
+// Set the contained value from a value of one of the alternatives.
+template <typename ...Ts>
+template <typename T_Value>
+void OneOf<Ts...>::setValue(std::true_type, T_Value &&value) {
+    using T_Decayed = typename std::decay<T_Value>::type;
+
+    if(indexOf<T_Decayed>() == _index) {
+        access<T_Decayed>() = std::forward<T_Value>(value);
+    } else {
+        replace<T_Decayed>(std::forward<T_Value>(value));
+    }
+}
+
+// Set the contained value from a value of any other type.
+template <typename ...Ts>
+template <typename T_Value>
+void OneOf<Ts...>::setValue(std::false_type, T_Value &&value) {
+    using T_Decayed = typename std::decay<T_Value>::type;
+
+    auto source = Detail::TypeInfo::instance<T_Decayed>();
+    ConvertAndAssign assign {
+        *this,
+        source,
+        const_cast<void *>(static_cast<void const *>(&value)),
+        !std::is_lvalue_reference<T_Value>::value &&
+        !std::is_const<typename std::remove_reference<T_Value>::type>::value
+    };
+    if(!Alternatives::template dispatch<bool>(_index, assign)) {
+        Detail::raiseSetError(getTypeInfo(), false, false, source);
+    }
+}
+
+}
+//--                          End Namespace Reflect                           --
+//------------------------------------------------------------------------------
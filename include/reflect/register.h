@@ -4,6 +4,12 @@
 #ifndef REFLECT_REGISTER_H
 #define REFLECT_REGISTER_H
 
+#include "detail/static_registration.h"
+#include "detail/traits.h"
+#include "detail/type_info.h"
+
+// std::size_t
+#include <cstddef>
 #include <string>
 #include <type_traits>
 
@@ -11,6 +17,118 @@
 //--                         Begin Namespace Reflect                          --
 namespace Reflect {
 
+//------------------------------------------------------------------------------
+//--                               Conversions                                --
+//------------------------------------------------------------------------------
+// Costs assigned to registered conversions. When multiple chains of
+// conversions lead from one type to another, the chain with the lowest total
+// cost is used. A conversion that may lose information should be registered
+// with a higher cost, so that lossless chains of several conversions are
+// preferred over it.
+constexpr unsigned DefaultConversionCost = 1;
+constexpr unsigned LossyConversionCost = 16;
+
+// Enable or disable transitive conversions globally. If enabled, a value that
+// cannot be converted to a type using a single registered conversion is
+// converted along the cheapest chain of registered conversions instead.
+// Transitive conversions are disabled by default.
+void setTransitiveConversions(bool enabled);
+
+// Returns true if transitive conversions are enabled.
+bool getTransitiveConversions();
+
+//------------------------------------------------------------------------------
+//--                                 Registry                                 --
+//------------------------------------------------------------------------------
+// Compact the base classes and conversions registered for all types into a
+// single contiguous block of memory, so that looking them up touches only a
+// few cache lines. Intended to be called once registration at startup has
+// completed.
+// Registering further information for a type after freezing is still
+// possible, but moves that type's information out of the compacted block
+// until freeze is called again.
+void freeze();
+
+// Returns true if the registry has been frozen and no information has been
+// registered since.
+bool isFrozen();
+
+// Write a snapshot of the registered type graph to the file at path,
+// including the chains of conversions derived from it, so that a later
+// process registering the same types can skip deriving them. Intended to be
+// called once registration at startup has completed.
+// Throws an exception if the file cannot be written.
+void saveSnapshot(std::string const &path);
+
+// Load the snapshot written to the file at path by saveSnapshot, using the
+// chains of conversions it contains until further information is registered.
+// Types must still be registered as usual before loading the snapshot.
+// Returns false, leaving the registry unchanged, if the file cannot be read
+// or does not match the registered type graph.
+bool loadSnapshot(std::string const &path);
+
+//------------------------------------------------------------------------------
+//--                           Static Registration                            --
+//------------------------------------------------------------------------------
+// Descriptions of registered information that contain only addresses and
+// constants. Declared constexpr, they are constant-initialized without
+// running any code at startup and placed in read-only memory, e.g.:
+//   constexpr Reflect::StaticBase fooBases[] = {
+//       Reflect::staticBase<Foo, Bar>()
+//   };
+//   constexpr Reflect::StaticType types[] = {
+//       Reflect::staticType<Foo>("Foo", fooBases),
+//       Reflect::staticType<Bar>("Bar")
+//   };
+// The described information is registered by passing the array of types to
+// registerStatic, which does not allocate memory per base class or
+// conversion.
+using StaticBase = Detail::StaticBase;
+using StaticConversion = Detail::StaticConversion;
+using StaticType = Detail::StaticType;
+
+// Describe type T_Base as a base class of type T.
+template <typename T, typename T_Base>
+constexpr StaticBase staticBase();
+
+// Describe a conversion from type T to type T_Target, constructing the
+// target from the source, with the specified relative cost.
+template <typename T, typename T_Target>
+constexpr StaticConversion staticConversion(
+    unsigned cost = DefaultConversionCost
+);
+
+// Describe type T with the specified name, base classes and conversions.
+// If name is nullptr, the type is registered without associating it with a
+// name.
+template <typename T>
+constexpr StaticType staticType(char const *name);
+
+template <typename T, std::size_t T_Bases>
+constexpr StaticType staticType(char const *name,
+                                StaticBase const (&bases)[T_Bases]);
+
+template <typename T, std::size_t T_Conversions>
+constexpr StaticType staticType(
+    char const *name,
+    StaticConversion const (&conversions)[T_Conversions]
+);
+
+template <typename T, std::size_t T_Bases, std::size_t T_Conversions>
+constexpr StaticType staticType(
+    char const *name,
+    StaticBase const (&bases)[T_Bases],
+    StaticConversion const (&conversions)[T_Conversions]
+);
+
+// Register the information described by the specified array of types, each
+// of which may appear only once.
+// Throws an exception if a name has already been used to globally register a
+// different type, in which case no base classes or conversions are
+// registered.
+template <std::size_t T_Count>
+void registerStatic(StaticType const (&types)[T_Count]);
+
 //------------------------------------------------------------------------------
 //--                              Class Register                              --
 //------------------------------------------------------------------------------
@@ -23,7 +141,9 @@ public:
 //-------------------------------  Registration  -------------------------------
 public:
     // Register information about type T without associating it with a name.
-    Register() = default;
+    // Values whose most-derived type is T can then be referenced with their
+    // dynamic type (see dynamicRef).
+    Register();
 
     // Register information about type T, associating it globally with name.
     // Throws an exception if name has already been used to globally register
@@ -38,19 +158,61 @@ public:
 
 //-------------------------------  Conversions  --------------------------------
 public:
-    // Register a conversion from type T to type T_Target.
+    // Register a conversion from type T to type T_Target with the specified
+    // relative cost.
     template <typename T_Target>
-    Register &conversion();
+    Register &conversion(unsigned cost = DefaultConversionCost);
 
     // Register a conversion from type T to type T_Target, using the specified
     // conversion method.
     template <typename T_Target, typename T_Base, typename T_Ret>
-    Register &conversion(T_Ret (T_Base::*method)() const);
+    Register &conversion(T_Ret (T_Base::*method)() const,
+                         unsigned cost = DefaultConversionCost);
 
     // Register a conversion from type T to type T_Target, using the specified
     // conversion function.
-    template <typename T_Target, typename T_Func>
-    Register &conversion(T_Func &&function);
+    template <
+        typename T_Target,
+        typename T_Func,
+        Detail::EnableIf<
+            !std::is_arithmetic<typename std::decay<T_Func>::type>::value
+        > = Detail::EnableIfType::Enabled
+    >
+    Register &conversion(T_Func &&function,
+                         unsigned cost = DefaultConversionCost);
+};
+
+//------------------------------------------------------------------------------
+//--                          Class DeferredRegister                          --
+//------------------------------------------------------------------------------
+// Defers registration of information about type T until the name, base
+// classes or conversions of T are first retrieved, reducing the startup cost
+// of registering types that are never used. Intended to be instantiated with
+// static storage duration, which records the registration without allocating
+// memory, e.g.:
+//   Reflect::DeferredRegister<Foo> registerFoo([]() {
+//       Reflect::Register<Foo>("Foo")
+//           .base<Bar>()
+//       ;
+//   });
+// The registration should only register information about type T. Until it
+// has been executed, T cannot be looked up by name or as a dynamic type.
+template <typename T>
+class DeferredRegister {
+public:
+    static_assert(std::is_same<T, typename std::decay<T>::type>::value,
+                  "Registration must be of unqualified type.");
+
+    // Defer the specified registration of type T, which is executed at most
+    // once.
+    explicit DeferredRegister(void (*registration)());
+
+    DeferredRegister(DeferredRegister const &) = delete;
+    DeferredRegister &operator=(DeferredRegister const &) = delete;
+
+private:
+    // Deferred registration recorded within the type information of T.
+    Detail::TypeInfo::Deferred _deferred;
 };
 
 }
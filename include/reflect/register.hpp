@@ -3,6 +3,8 @@
 
 #include "detail/accessor.h"
 #include "detail/buffer.h"
+#include "detail/dynamic_type.h"
+#include "detail/static_registration.h"
 #include "detail/type_info.h"
 
 //------------------------------------------------------------------------------
@@ -13,9 +15,15 @@ namespace Reflect {
 //--                              Class Register                              --
 //------------------------------------------------------------------------------
 
+template <typename T>
+Register<T>::Register() {
+    Detail::registerDynamicType<T>();
+}
+
 template <typename T>
 Register<T>::Register(std::string name) {
     Detail::TypeInfo::mutableInstance<T>()->registerName(std::move(name));
+    Detail::registerDynamicType<T>();
 }
 
 //-------------------------------  Inheritance  --------------------------------
@@ -29,19 +37,11 @@ Register<T> &Register<T>::base() {
         "Base must be of unqualified type."
     );
 
-    struct RegisterBase {
-        // Upcast value to the base type.
-        static void const *upcast(void const *value) {
-            T_Base const *base = static_cast<T const *>(value);
-            return base;
-        }
-    };
-
     // Register base class in the type information instance for T.
     Detail::TypeInfo::mutableInstance<T>()->registerBase(
         Detail::Base(
             Detail::TypeInfo::instance<T_Base>(),
-            &RegisterBase::upcast
+            &Detail::UpcastFunctions<T, T_Base>::upcast
         )
     );
 
@@ -53,38 +53,13 @@ Register<T> &Register<T>::base() {
 // Register a conversion from type T to type T_Target.
 template <typename T>
 template <typename T_Target>
-Register<T> &Register<T>::conversion() {
+Register<T> &Register<T>::conversion(unsigned cost) {
     static_assert(
         std::is_same<T_Target, typename std::decay<T_Target>::type>::value,
         "Target must be of unqualified type."
     );
 
-    struct RegisterConversion {
-        // Retrieve value, which must be of type T, as the target type.
-        static void *get(void const *value, Detail::Buffer<void> &buffer) {
-            return buffer.construct<T_Target>(
-                *static_cast<T const *>(value)
-            );
-        }
-
-        // Set the accessed value in storage, which must be of the target type,
-        // by copy-assigning value, which must be of type T.
-        static bool set(Detail::Accessor const *accessor,
-                        Detail::Storage &storage,
-                        void const *value) {
-            T_Target target = *static_cast<T const *>(value);
-            return accessor->move(storage, &target);
-        }
-
-        // Set the accessed value in storage, which must be of the target type,
-        // by move-assigning value, which must be of type T.
-        static bool move(Detail::Accessor const *accessor,
-                         Detail::Storage &storage,
-                         void *value) {
-            T_Target target = std::move(*static_cast<T *>(value));
-            return accessor->move(storage, &target);
-        }
-    };
+    using RegisterConversion = Detail::ConversionFunctions<T, T_Target>;
 
     // Register conversion in the type information instance for T.
     Detail::TypeInfo::mutableInstance<T>()->registerConversion(
@@ -92,7 +67,11 @@ Register<T> &Register<T>::conversion() {
             Detail::TypeInfo::instance<T_Target>(),
             &RegisterConversion::get,
             &RegisterConversion::set,
-            &RegisterConversion::move
+            &RegisterConversion::move,
+            &RegisterConversion::destruct,
+            sizeof(T_Target),
+            alignof(T_Target),
+            cost
         )
     );
 
@@ -101,7 +80,8 @@ Register<T> &Register<T>::conversion() {
 
 template <typename T>
 template <typename T_Target, typename T_Base, typename T_Ret>
-Register<T> &Register<T>::conversion(T_Ret (T_Base::*method)() const) {
+Register<T> &Register<T>::conversion(T_Ret (T_Base::*method)() const,
+                                     unsigned cost) {
     static_assert(
         std::is_same<T_Target, typename std::decay<T_Target>::type>::value,
         "Target must be of unqualified type."
@@ -137,6 +117,11 @@ Register<T> &Register<T>::conversion(T_Ret (T_Base::*method)() const) {
             T_Target target = (static_cast<T const *>(value)->*convert)();
             return accessor->move(storage, &target);
         }
+
+        // Destruct value, which must be of the target type.
+        static void destruct(void *value) {
+            static_cast<T_Target *>(value)->~T_Target();
+        }
     };
 
     // Register conversion in the type information instance for T.
@@ -145,7 +130,11 @@ Register<T> &Register<T>::conversion(T_Ret (T_Base::*method)() const) {
             Detail::TypeInfo::instance<T_Target>(),
             &RegisterConversionMethod::get,
             &RegisterConversionMethod::set,
-            &RegisterConversionMethod::move
+            &RegisterConversionMethod::move,
+            &RegisterConversionMethod::destruct,
+            sizeof(T_Target),
+            alignof(T_Target),
+            cost
         )
     );
 
@@ -153,8 +142,14 @@ Register<T> &Register<T>::conversion(T_Ret (T_Base::*method)() const) {
 }
 
 template <typename T>
-template <typename T_Target, typename T_Func>
-Register<T> &Register<T>::conversion(T_Func &&function) {
+template <
+    typename T_Target,
+    typename T_Func,
+    Detail::EnableIf<
+        !std::is_arithmetic<typename std::decay<T_Func>::type>::value
+    >
+>
+Register<T> &Register<T>::conversion(T_Func &&function, unsigned cost) {
     static_assert(
         std::is_same<T_Target, typename std::decay<T_Target>::type>::value,
         "Target must be of unqualified type."
@@ -190,6 +185,11 @@ Register<T> &Register<T>::conversion(T_Func &&function) {
             T_Target target = convert(std::move(*static_cast<T *>(value)));
             return accessor->move(storage, &target);
         }
+
+        // Destruct value, which must be of the target type.
+        static void destruct(void *value) {
+            static_cast<T_Target *>(value)->~T_Target();
+        }
     };
 
     // Register conversion in the type information instance for T.
@@ -198,13 +198,114 @@ Register<T> &Register<T>::conversion(T_Func &&function) {
             Detail::TypeInfo::instance<T_Target>(),
             &RegisterConversionFunction::get,
             &RegisterConversionFunction::set,
-            &RegisterConversionFunction::move
+            &RegisterConversionFunction::move,
+            &RegisterConversionFunction::destruct,
+            sizeof(T_Target),
+            alignof(T_Target),
+            cost
         )
     );
 
     return *this;
 }
 
+//------------------------------------------------------------------------------
+//--                          Class DeferredRegister                          --
+//------------------------------------------------------------------------------
+
+template <typename T>
+DeferredRegister<T>::DeferredRegister(void (*registration)())
+: _deferred { registration, nullptr } {
+    Detail::TypeInfo::mutableInstance<T>()->registerDeferred(_deferred);
+}
+
+//------------------------------------------------------------------------------
+//--                           Static Registration                            --
+//------------------------------------------------------------------------------
+
+// Describe type T_Base as a base class of type T.
+template <typename T, typename T_Base>
+constexpr StaticBase staticBase() {
+    return {
+        &Detail::TypeInfo::instance<T_Base>,
+        &Detail::UpcastFunctions<T, T_Base>::upcast
+    };
+}
+
+// Describe a conversion from type T to type T_Target.
+template <typename T, typename T_Target>
+constexpr StaticConversion staticConversion(unsigned cost) {
+    return {
+        &Detail::TypeInfo::instance<T_Target>,
+        &Detail::ConversionFunctions<T, T_Target>::get,
+        &Detail::ConversionFunctions<T, T_Target>::set,
+        &Detail::ConversionFunctions<T, T_Target>::move,
+        &Detail::ConversionFunctions<T, T_Target>::destruct,
+        sizeof(T_Target),
+        alignof(T_Target),
+        cost
+    };
+}
+
+// Describe type T with the specified name, base classes and conversions.
+template <typename T>
+constexpr StaticType staticType(char const *name) {
+    return {
+        &Detail::TypeInfo::mutableInstance<T>,
+        &Detail::registerDynamicType<T>,
+        name,
+        nullptr, 0,
+        nullptr, 0
+    };
+}
+
+template <typename T, std::size_t T_Bases>
+constexpr StaticType staticType(char const *name,
+                                StaticBase const (&bases)[T_Bases]) {
+    return {
+        &Detail::TypeInfo::mutableInstance<T>,
+        &Detail::registerDynamicType<T>,
+        name,
+        bases, T_Bases,
+        nullptr, 0
+    };
+}
+
+template <typename T, std::size_t T_Conversions>
+constexpr StaticType staticType(
+    char const *name,
+    StaticConversion const (&conversions)[T_Conversions]
+) {
+    return {
+        &Detail::TypeInfo::mutableInstance<T>,
+        &Detail::registerDynamicType<T>,
+        name,
+        nullptr, 0,
+        conversions, T_Conversions
+    };
+}
+
+template <typename T, std::size_t T_Bases, std::size_t T_Conversions>
+constexpr StaticType staticType(
+    char const *name,
+    StaticBase const (&bases)[T_Bases],
+    StaticConversion const (&conversions)[T_Conversions]
+) {
+    return {
+        &Detail::TypeInfo::mutableInstance<T>,
+        &Detail::registerDynamicType<T>,
+        name,
+        bases, T_Bases,
+        conversions, T_Conversions
+    };
+}
+
+// Register the information described by the specified array of types.
+template <std::size_t T_Count>
+void registerStatic(StaticType const (&types)[T_Count]) {
+    Detail::TypeInfo::registerStatic(types, T_Count);
+}
+
 }
 //--                          End Namespace Reflect                           --
 //------------------------------------------------------------------------------
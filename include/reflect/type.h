@@ -8,7 +8,15 @@
 #include "detail/iterator_value.h"
 #include "detail/type_info.h"
 
+// std::size_t
+#include <cstddef>
+// std::uint64_t, std::uintptr_t
+#include <cstdint>
+// std::hash
+#include <functional>
 #include <ostream>
+#include <string>
+#include <vector>
 
 //------------------------------------------------------------------------------
 //--                         Begin Namespace Reflect                          --
@@ -22,28 +30,68 @@ class Type {
 //-----------------------------  Public Interface  -----------------------------
 public:
     // Retrieve the shortest name by which the type has been registered.
-    std::string const &getName() const { return _typeInfo->getName(); }
+    std::string const &getName() const { return getTypeInfo()->getName(); }
 
     // Returns true if the type is constant, e.g., T const.
-    bool isConstant() const { return _constant; }
+    bool isConstant() const { return (_value & Constant) != 0; }
 
     // Returns true if the type is a reference, e.g., T &.
-    bool isReference() const { return _reference; }
+    bool isReference() const { return (_value & Reference) != 0; }
+
+    // Retrieve a 64-bit hash of the type, including its qualifiers.
+    // The hash is derived from the first name by which the type has been
+    // registered and is therefore identical across processes and builds,
+    // making it suitable as a compact identifier of the type, e.g., when
+    // transmitting values. Types should be registered with a name before
+    // their hash is first retrieved.
+    std::uint64_t getHash() const {
+        std::uint64_t qualifiers = (isConstant() ? 1 : 0)
+                                 | (isReference() ? 2 : 0);
+        return (getTypeInfo()->getHash() ^ qualifiers) * 0x100000001b3ull;
+    }
+
+//----------------------------------  Layout  ----------------------------------
+public:
+    // Layout properties of the unqualified type, allowing generic code to
+    // size buffers, copy values bitwise or skip destructors without accessing
+    // individual values. Void has a size and alignment of zero.
+    std::size_t getSize() const {
+        return getTypeInfo()->getLayout().size;
+    }
+    std::size_t getAlignment() const {
+        return getTypeInfo()->getLayout().alignment;
+    }
+    bool isTriviallyCopyable() const {
+        return getTypeInfo()->getLayout().triviallyCopyable;
+    }
+    bool isTriviallyDestructible() const {
+        return getTypeInfo()->getLayout().triviallyDestructible;
+    }
+    bool isStandardLayout() const {
+        return getTypeInfo()->getLayout().standardLayout;
+    }
 
 //-------------------------------  Base Classes  -------------------------------
 public:
+    // Returns true if the type is base, or has base as a direct or indirect
+    // registered base class, disregarding qualifiers.
+    // The query takes constant time, using an index of the registered base
+    // classes that is rebuilt when first queried after registration.
+    bool isDerivedFrom(Type const &base) const;
+
     // Iterate over all registered base class types of the type.
     using BaseIterator = Detail::IteratorValue<
         Detail::TypeInfo::BaseIterator, Type
     >;
     Detail::IteratorRange<BaseIterator> getBases() const {
-        return { beginBases(), endBases() };
+        auto bases = getTypeInfo()->getBases();
+        return { bases.begin(), bases.end() };
     }
     BaseIterator beginBases() const {
-        return _typeInfo->beginBases();
+        return getTypeInfo()->beginBases();
     }
     BaseIterator endBases() const {
-        return _typeInfo->endBases();
+        return getTypeInfo()->endBases();
     }
 
 //-------------------------------  Conversions  --------------------------------
@@ -53,20 +101,28 @@ public:
         Detail::TypeInfo::ConversionIterator, Type
     >;
     Detail::IteratorRange<ConversionIterator> getConversions() const {
-        return { beginConversions(), endConversions() };
+        auto conversions = getTypeInfo()->getConversions();
+        return { conversions.begin(), conversions.end() };
     }
     ConversionIterator beginConversions() const {
-        return _typeInfo->beginConversions();
+        return getTypeInfo()->beginConversions();
     }
     ConversionIterator endConversions() const {
-        return _typeInfo->endConversions();
+        return getTypeInfo()->endConversions();
     }
 
+    // Retrieve all types to which the type can be converted through a chain
+    // of one or more registered conversions and base classes, ordered by
+    // increasing total conversion cost. Types reachable through base classes
+    // alone are not included.
+    // This does not depend on whether transitive conversions are enabled.
+    std::vector<Type> getReachableConversions() const;
+
 //--------------------------------  Operators  ---------------------------------
 public:
-    // Comparison operators providing an ordering of types.
-    // The order is consistent throughout a single invocation of the program,
-    // but may change from one invocation to the next.
+    // Comparison operators providing an ordering of types by their hashes.
+    // The order of types registered with a name is consistent across
+    // invocations of the program. Equality compares a single word.
     friend bool operator==(Type const &lhs, Type const &rhs);
     friend bool operator!=(Type const &lhs, Type const &rhs);
     friend bool operator<(Type const &lhs, Type const &rhs);
@@ -82,30 +138,49 @@ public:
     // Internal general-purpose constructor, use the templated getType function
     // instead.
     Type(Detail::TypeInfo const *typeInfo, bool constant, bool reference)
-    : _typeInfo(typeInfo), _constant(constant), _reference(reference) { }
+    : _value(reinterpret_cast<std::uintptr_t>(typeInfo)
+             | (constant ? std::uintptr_t(Constant) : 0)
+             | (reference ? std::uintptr_t(Reference) : 0)) { }
 
     // Internal constructor for base class type iteration, use the derived
     // type's base class type iteration methods instead.
     Type(Detail::Base const &base)
-    : _typeInfo(base.getTypeInfo())
-    , _constant(false)
-    , _reference(false) { }
+    : _value(reinterpret_cast<std::uintptr_t>(base.getTypeInfo())) { }
 
     // Internal constructor for conversion target type iteration, use the source
     // type's conversion target type iteration methods instead.
     Type(Detail::Conversion const &conversion)
-    : _typeInfo(conversion.getTypeInfo())
-    , _constant(false)
-    , _reference(false) { }
+    : _value(reinterpret_cast<std::uintptr_t>(conversion.getTypeInfo())) { }
+
+    // Internal access to the type information associated with the type.
+    Detail::TypeInfo const *getTypeInfo() const {
+        return reinterpret_cast<Detail::TypeInfo const *>(
+            _value & ~std::uintptr_t(Constant | Reference)
+        );
+    }
+
+//----------------------------  Private Interface  -----------------------------
+private:
+    // Qualifiers stored in the low bits of the type information address.
+    // The constant qualifier is the more significant bit, so that comparing
+    // the packed values of the same type orders unqualified types first.
+    enum Qualifiers : std::uintptr_t {
+        Reference = 1,
+        Constant = 2
+    };
+
+    static_assert(alignof(Detail::TypeInfo) > (Constant | Reference),
+                  "Internal error: Type information is insufficiently "
+                  "aligned to hold qualifiers.");
+
+    // Returns true if lhs is ordered before rhs, which must differ.
+    static bool less(Type const &lhs, Type const &rhs);
 
 //-----------------------------  Private Members  ------------------------------
 private:
-    // Type information associated with the type.
-    Detail::TypeInfo const *_typeInfo;
-    // Constant qualifier.
-    bool _constant;
-    // Reference qualifier.
-    bool _reference;
+    // Address of the type information associated with the type, with the
+    // constant and reference qualifiers in its low bits.
+    std::uintptr_t _value;
 };
 
 //---------------------------  Non-Member Functions  ---------------------------
@@ -114,10 +189,40 @@ private:
 template <typename T>
 Type getType();
 
+// Retrieve the unqualified type globally registered with the specified name.
+// The lookup does not allocate memory, allowing names to be resolved at
+// runtime without penalty.
+// Throws an exception if no type has been registered with name.
+Type getType(char const *name);
+Type getType(std::string const &name);
+Type getType(char const *name, std::size_t size);
+
+// Look up the unqualified type globally registered with the specified name,
+// storing it in type without raising an error.
+// Returns false, leaving type unchanged, if no type has been registered with
+// name.
+bool findType(std::string const &name, Type &type);
+
 }
 //--                          End Namespace Reflect                           --
 //------------------------------------------------------------------------------
 
+//------------------------------------------------------------------------------
+//--                           Begin Namespace std                            --
+namespace std {
+
+// Hash of a type, allowing types to be used as keys of unordered containers.
+template <>
+struct hash<Reflect::Type> {
+    std::size_t operator()(Reflect::Type const &type) const {
+        return static_cast<std::size_t>(type.getHash());
+    }
+};
+
+}
+//--                            End Namespace std                             --
+//------------------------------------------------------------------------------
+
 #include "type.hpp"
 
 #endif
@@ -3,6 +3,8 @@
 
 #include "detail/type_info.h"
 
+// std::uint64_t
+#include <cstdint>
 #include <type_traits>
 
 //------------------------------------------------------------------------------
@@ -13,6 +15,46 @@ namespace Reflect {
 //--                                Class Type                                --
 //------------------------------------------------------------------------------
 
+//--------------------------------  Operators  ---------------------------------
+
+// Returns true if lhs is ordered before rhs.
+inline bool Type::less(Type const &lhs, Type const &rhs) {
+    Detail::TypeInfo const *lhsTypeInfo = lhs.getTypeInfo();
+    Detail::TypeInfo const *rhsTypeInfo = rhs.getTypeInfo();
+    if(lhsTypeInfo != rhsTypeInfo) {
+        std::uint64_t lhsHash = lhsTypeInfo->getHash();
+        std::uint64_t rhsHash = rhsTypeInfo->getHash();
+        if(lhsHash != rhsHash) return lhsHash < rhsHash;
+    }
+    // Order by address if the hashes collide, and by qualifiers otherwise.
+    return lhs._value < rhs._value;
+}
+
+// Comparison operators.
+inline bool operator==(Type const &lhs, Type const &rhs) {
+    return lhs._value == rhs._value;
+}
+
+inline bool operator!=(Type const &lhs, Type const &rhs) {
+    return lhs._value != rhs._value;
+}
+
+inline bool operator<(Type const &lhs, Type const &rhs) {
+    return lhs._value != rhs._value && Type::less(lhs, rhs);
+}
+
+inline bool operator<=(Type const &lhs, Type const &rhs) {
+    return lhs._value == rhs._value || Type::less(lhs, rhs);
+}
+
+inline bool operator>(Type const &lhs, Type const &rhs) {
+    return lhs._value != rhs._value && Type::less(rhs, lhs);
+}
+
+inline bool operator>=(Type const &lhs, Type const &rhs) {
+    return lhs._value == rhs._value || Type::less(rhs, lhs);
+}
+
 //---------------------------  Non-Member Functions  ---------------------------
 
 // Create a type instance for type T.
@@ -0,0 +1,48 @@
+// Copyright (c) 2019 Johannes Zeppenfeld
+// SPDX-License-Identifier: MIT
+
+#ifndef REFLECT_VISIT_H
+#define REFLECT_VISIT_H
+
+#include "object.h"
+
+#include "detail/traits.h"
+#include "detail/visit.h"
+
+//------------------------------------------------------------------------------
+//--                         Begin Namespace Reflect                          --
+namespace Reflect {
+
+//------------------------------------------------------------------------------
+//--                              Function visit                              --
+//------------------------------------------------------------------------------
+// Call the visitor whose parameter type best matches the reflected type of
+// object with the contained value, returning the visitor's result.
+// A visitor accepting the reflected type is preferred over a visitor accepting
+// one of its registered base classes (nearest first), which is in turn
+// preferred over a visitor accepting a registered conversion of the reflected
+// type. Among equally good matches, the visitor specified first is called.
+// Visitors must be non-generic callables taking a single parameter. Visitors
+// taking a mutable reference are only called for non-constant values, and
+// registered conversions are only considered for visitors taking their
+// parameter by value or constant reference.
+// The selected visitor is determined once per reflected type and set of
+// visitor types, after which dispatch is a table lookup.
+// Throws an exception if none of the visitors can accept the contained value.
+template <
+    typename T_Object,
+    typename ...T_Visitors,
+    Detail::EnableIf<
+        Detail::IsVisitable<typename std::decay<T_Object>::type>::value
+    > = Detail::EnableIfType::Enabled
+>
+Detail::VisitResult<T_Visitors...> visit(T_Object &&object,
+                                         T_Visitors &&...visitors);
+
+}
+//--                          End Namespace Reflect                           --
+//------------------------------------------------------------------------------
+
+#include "visit.hpp"
+
+#endif
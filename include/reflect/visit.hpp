@@ -0,0 +1,37 @@
+// Copyright (c) 2019 Johannes Zeppenfeld
+// SPDX-License-Identifier: MIT
+
+#include "detail/visit.h"
+
+//------------------------------------------------------------------------------
+//--                         Begin Namespace Reflect                          --
+namespace Reflect {
+
+//------------------------------------------------------------------------------
+//--                              Function visit                              --
+//------------------------------------------------------------------------------
+
+// Call the visitor whose parameter type best matches the reflected type of
+// object with the contained value.
+template <
+    typename T_Object,
+    typename ...T_Visitors,
+    Detail::EnableIf<
+        Detail::IsVisitable<typename std::decay<T_Object>::type>::value
+    >
+>
+Detail::VisitResult<T_Visitors...> visit(T_Object &&object,
+                                         T_Visitors &&...visitors) {
+    using T_Visit = Detail::Visit<
+        typename std::remove_reference<T_Object>::type, T_Visitors...
+    >;
+
+    typename T_Visit::Visitors forwarded(
+        std::forward<T_Visitors>(visitors)...
+    );
+    return T_Visit::visit(object, forwarded);
+}
+
+}
+//--                          End Namespace Reflect                           --
+//------------------------------------------------------------------------------
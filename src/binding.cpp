@@ -0,0 +1,125 @@
+// Copyright (c) 2019 Johannes Zeppenfeld
+// SPDX-License-Identifier: MIT
+
+#include "reflect/binding.h"
+
+#include "reflect/detail/accessor.h"
+#include "reflect/detail/convert.h"
+#include "reflect/detail/type_info.h"
+
+//------------------------------------------------------------------------------
+//--                         Begin Namespace Reflect                          --
+namespace Reflect {
+
+//------------------------------------------------------------------------------
+//--                              Class Binding                               --
+//------------------------------------------------------------------------------
+
+// Construct an unresolved binding.
+Binding::Binding()
+: _target(nullptr)
+, _source(nullptr)
+, _converting(false) { }
+
+//----------------------------  Private Interface  -----------------------------
+
+// Assign the value in source to the value in target.
+void Binding::apply(Detail::Accessor const *targetAccessor,
+                    Detail::Storage &target,
+                    Detail::Accessor const *sourceAccessor,
+                    Detail::Storage const &source) {
+    // Accessors are shared by all values of equally qualified types, so the
+    // route remains valid so long as neither accessor changes.
+    if(targetAccessor != _target || sourceAccessor != _source) {
+        resolve(targetAccessor, sourceAccessor);
+    }
+
+    // Create visitor to pass the source value along the resolved route.
+    class Visitor : public Detail::Accessor::Visitor {
+    public:
+        Visitor(Binding const &binding, Detail::Storage &storage)
+        : _binding(binding)
+        , _storage(storage) { }
+
+        void *visit(void *value, bool constant, bool temporary) override {
+            for(auto &&base : _binding._upcasts) {
+                value = base.upcast(value);
+            }
+
+            bool movable = temporary && !constant;
+            bool assigned;
+            if(_binding._converting) {
+                assigned = movable
+                    ? _binding._conversion.move(_binding._target,
+                                                _storage, value)
+                    : _binding._conversion.set(_binding._target,
+                                               _storage, value);
+            } else {
+                assigned = movable
+                    ? _binding._target->move(_storage, value)
+                    : _binding._target->set(_storage, value);
+            }
+            if(!assigned) {
+                Detail::raiseSetError(_binding._target->getTypeInfo(),
+                                      _binding._target->isConstant(),
+                                      _binding._target->isReference(),
+                                      _binding._source->getTypeInfo());
+            }
+            return nullptr;
+        }
+
+    private:
+        Binding const &_binding;
+        Detail::Storage &_storage;
+    } visitor(*this, target);
+
+    sourceAccessor->accept(source, visitor);
+}
+
+// Resolve the route between the specified accessors.
+void Binding::resolve(Detail::Accessor const *targetAccessor,
+                      Detail::Accessor const *sourceAccessor) {
+    _target = nullptr;
+    _source = nullptr;
+    _upcasts.clear();
+    _converting = false;
+
+    Detail::TypeInfo const *target = targetAccessor->getTypeInfo();
+    Detail::TypeInfo const *source = sourceAccessor->getTypeInfo();
+    if(source != target && !resolve(source, target)) {
+        Detail::raiseSetError(target,
+                              targetAccessor->isConstant(),
+                              targetAccessor->isReference(),
+                              source);
+    }
+
+    _target = targetAccessor;
+    _source = sourceAccessor;
+}
+
+// Recursively resolve the upcasts and conversion from source to target.
+bool Binding::resolve(Detail::TypeInfo const *source,
+                      Detail::TypeInfo const *target) {
+    // Look for a registered conversion from source to the target type.
+    for(auto &&conversion : source->getConversions()) {
+        if(conversion.getTypeInfo() == target) {
+            _conversion = conversion;
+            _converting = true;
+            return true;
+        }
+    }
+
+    // Recursively check base classes.
+    for(auto &&base : source->getBases()) {
+        _upcasts.push_back(base);
+        if(base.getTypeInfo() == target) return true;
+        if(resolve(base.getTypeInfo(), target)) return true;
+        _upcasts.pop_back();
+    }
+
+    return false;
+}
+
+}
+//--                          End Namespace Reflect                           --
+//------------------------------------------------------------------------------
@@ -3,13 +3,10 @@
 
 #include "reflect/detail/accessor.h"
 
-#include "reflect/detail/base.h"
 #include "reflect/detail/buffer.h"
-#include "reflect/detail/conversion.h"
+#include "reflect/detail/convert.h"
 #include "reflect/detail/type_info.h"
 
-#include <stdexcept>
-
 //------------------------------------------------------------------------------
 //--                     Begin Namespace Reflect::Detail                      --
 namespace Reflect { namespace Detail {
@@ -34,40 +31,8 @@ namespace {
         // If movable is true, value references a temporary that may be moved.
         void *convert(TypeInfo const *typeInfo, void *value,
                       bool referable, bool movable) {
-            // No conversion is necessary if typeInfo matches the target type.
-            if(typeInfo == _targetTypeInfo) {
-                // Return a reference to value if possible.
-                if(referable) {
-                    return value;
-                // Otherwise, try to move or copy value into the target buffer.
-                } else if(_buffer) {
-                    void *copy = movable ? _buffer->constructMove(value)
-                                         : _buffer->constructCopy(value);
-                    if(copy) return copy;
-                }
-            }
-
-            // If a target buffer is available, look for a registered conversion
-            // from typeInfo to the target type.
-            if(_buffer) {
-                for(auto &&conversion : typeInfo->getConversions()) {
-                    if(conversion.getTypeInfo() == _targetTypeInfo) {
-                        return conversion.get(value, *_buffer);
-                    }
-                }
-            }
-
-            // Recursively check base classes.
-            for(auto &&base : typeInfo->getBases()) {
-                void *converted = convert(base.getTypeInfo(),
-                                          base.upcast(value),
-                                          referable,
-                                          movable);
-                if(converted) return converted;
-            }
-
-            // No conversion found.
-            return nullptr;
+            return Detail::convert(typeInfo, value, _targetTypeInfo,
+                                   referable, movable, _buffer);
         }
 
     private:
@@ -77,66 +42,37 @@ namespace {
         // constructed.
         Buffer<void> *_buffer;
     };
-
-    // Convert value from the type associated with typeInfo and copy-assign it
-    // to the accessed storage.
-    bool convertAndSet(Accessor const *accessor, Storage &storage,
-                       TypeInfo const *typeInfo, void const *value) {
-        // Look for a registered conversion from typeInfo to the accessed type.
-        for(auto &&conversion : typeInfo->getConversions()) {
-            if(conversion.getTypeInfo() == accessor->getTypeInfo()) {
-                if(conversion.set(accessor, storage, value)) {
-                    return true;
-                }
-            }
-        }
-
-        // Recursively check base classes.
-        for(auto &&base : typeInfo->getBases()) {
-            void const *upcast = base.upcast(value);
-            if(base.getTypeInfo() == accessor->getTypeInfo()) {
-                return accessor->set(storage, upcast);
-            }
-            if(convertAndSet(accessor, storage, base.getTypeInfo(), upcast)) {
-                return true;
-            }
-        }
-
-        return false;
-    }
-
-    // Convert value from the type associated with typeInfo and move-assign it
-    // to the accessed storage.
-    bool convertAndMove(Accessor const *accessor, Storage &storage,
-                        TypeInfo const *typeInfo, void *value) {
-        // Look for a registered conversion from typeInfo to the accessed type.
-        for(auto &&conversion : typeInfo->getConversions()) {
-            if(conversion.getTypeInfo() == accessor->getTypeInfo()) {
-                if(conversion.move(accessor, storage, value)) {
-                    return true;
-                }
-            }
-        }
-
-        // Recursively check base classes.
-        for(auto &&base : typeInfo->getBases()) {
-            void *upcast = base.upcast(value);
-            if(base.getTypeInfo() == accessor->getTypeInfo()) {
-                return accessor->move(storage, upcast);
-            }
-            if(convertAndMove(accessor, storage, base.getTypeInfo(), upcast)) {
-                return true;
-            }
-        }
-
-        return false;
-    }
 }
 
 // Retrieve the value in storage as the type associated with typeInfo.
 void *Accessor::getAs(Storage const &storage,
                       TypeInfo const *typeInfo,
                       Buffer<void> *buffer) const {
+    void *result = tryGetAs(storage, typeInfo, buffer);
+    if(!result) {
+        raiseGetError(_typeInfo, _constant, _reference,
+                      typeInfo, buffer ? "" : " &");
+    }
+    return result;
+}
+
+// Retrieve the value in storage as the constant type associated with typeInfo.
+void const *Accessor::getAsConst(Storage const &storage,
+                                 TypeInfo const *typeInfo,
+                                 Buffer<void> *buffer) const {
+    void const *result = tryGetAsConst(storage, typeInfo, buffer);
+    if(!result) {
+        raiseGetError(_typeInfo, true, _reference,
+                      typeInfo, buffer ? "" : " const &");
+    }
+    return result;
+}
+
+// Retrieve the value in storage as the type associated with typeInfo, or
+// nullptr if the value cannot be retrieved as specified.
+void *Accessor::tryGetAs(Storage const &storage,
+                         TypeInfo const *typeInfo,
+                         Buffer<void> *buffer) const {
     // Create visitor to retrieve and convert value from storage.
     class Visitor : public ConversionVisitor {
     public:
@@ -155,22 +91,14 @@ void *Accessor::getAs(Storage const &storage,
         TypeInfo const *_sourceTypeInfo;
     } visitor(_typeInfo, typeInfo, buffer);
 
-    void *result = accept(storage, visitor);
-    if(!result) {
-        throw std::runtime_error(
-            "Could not retrieve type '" + _typeInfo->getName()
-            + (_constant ? " const" : "") + (_reference ? " &" : "")
-            + "' as type '" + typeInfo->getName() + (buffer ? "" : " &")
-            + "'."
-        );
-    }
-    return result;
+    return accept(storage, visitor);
 }
 
-// Retrieve the value in storage as the constant type associated with typeInfo.
-void const *Accessor::getAsConst(Storage const &storage,
-                                 TypeInfo const *typeInfo,
-                                 Buffer<void> *buffer) const {
+// Retrieve the value in storage as the constant type associated with typeInfo,
+// or nullptr if the value cannot be retrieved as specified.
+void const *Accessor::tryGetAsConst(Storage const &storage,
+                                    TypeInfo const *typeInfo,
+                                    Buffer<void> *buffer) const {
     // Create visitor to retrieve and convert value from storage.
     class Visitor : public ConversionVisitor {
     public:
@@ -189,16 +117,7 @@ void const *Accessor::getAsConst(Storage const &storage,
         TypeInfo const *_sourceTypeInfo;
     } visitor(_typeInfo, typeInfo, buffer);
 
-    void const *result = accept(storage, visitor);
-    if(!result) {
-        throw std::runtime_error(
-            "Could not retrieve type '" + _typeInfo->getName()
-            + " const" + (_reference ? " &" : "")
-            + "' as type '" + typeInfo->getName() + (buffer ? "" : " const &")
-            + "'."
-        );
-    }
-    return result;
+    return accept(storage, visitor);
 }
 
 // Set the value in storage, which must be of the accessed type, by
@@ -206,16 +125,21 @@ void const *Accessor::getAsConst(Storage const &storage,
 void Accessor::setAs(Storage &storage,
                      TypeInfo const *typeInfo,
                      void const *value) const {
-    if(typeInfo == _typeInfo) {
-        if(set(storage, value)) return;
+    if(!trySetAs(storage, typeInfo, value)) {
+        raiseSetError(_typeInfo, _constant, _reference, typeInfo);
     }
-    if(!convertAndSet(this, storage, typeInfo, value)) {
-        throw std::runtime_error(
-            "Could not set type '" + _typeInfo->getName()
-            + (_constant ? " const" : "") + (_reference ? " &" : "")
-            + "' from type '" + typeInfo->getName() + "'."
-        );
+}
+
+// Set the value in storage, which must be of the accessed type, by
+// copy-assigning the specified value of the type associated with typeInfo.
+// Returns false if the assignment cannot be made.
+bool Accessor::trySetAs(Storage &storage,
+                        TypeInfo const *typeInfo,
+                        void const *value) const {
+    if(typeInfo == _typeInfo) {
+        if(set(storage, value)) return true;
     }
+    return convertAndSet(this, storage, typeInfo, value);
 }
 
 // Set the value in storage, which must be of the accessed type, by
@@ -256,16 +180,21 @@ void Accessor::setAs(Storage &storage,
 void Accessor::moveAs(Storage &storage,
                       TypeInfo const *typeInfo,
                       void *value) const {
-    if(typeInfo == _typeInfo) {
-        if(move(storage, value)) return;
+    if(!tryMoveAs(storage, typeInfo, value)) {
+        raiseSetError(_typeInfo, _constant, _reference, typeInfo);
     }
-    if(!convertAndMove(this, storage, typeInfo, value)) {
-        throw std::runtime_error(
-            "Could not set type '" + _typeInfo->getName()
-            + (_constant ? " const" : "") + (_reference ? " &" : "")
-            + "' from type '" + typeInfo->getName() + "'."
-        );
+}
+
+// Set the value in storage, which must be of the accessed type, by
+// move-assigning the specified value of the type associated with typeInfo.
+// Returns false if the assignment cannot be made.
+bool Accessor::tryMoveAs(Storage &storage,
+                         TypeInfo const *typeInfo,
+                         void *value) const {
+    if(typeInfo == _typeInfo) {
+        if(move(storage, value)) return true;
     }
+    return convertAndMove(this, storage, typeInfo, value);
 }
 
 // Set the value in storage, which must be of the accessed type, by
@@ -0,0 +1,490 @@
+// Copyright (c) 2019 Johannes Zeppenfeld
+// SPDX-License-Identifier: MIT
+
+#include "reflect/detail/convert.h"
+
+#include "reflect/detail/accessor.h"
+#include "reflect/detail/base.h"
+#include "reflect/detail/buffer.h"
+#include "reflect/detail/conversion.h"
+#include "reflect/detail/error.h"
+#include "reflect/detail/hierarchy.h"
+#include "reflect/detail/type_info.h"
+
+#include "reflect/register.h"
+
+// std::atomic
+#include <atomic>
+// std::size_t
+#include <cstddef>
+// std::greater
+#include <functional>
+// std::align, std::unique_ptr
+#include <memory>
+// std::mutex
+#include <mutex>
+// std::priority_queue
+#include <queue>
+// std::tuple
+#include <tuple>
+// std::unordered_map
+#include <unordered_map>
+
+//------------------------------------------------------------------------------
+//--                     Begin Namespace Reflect::Detail                      --
+namespace Reflect { namespace Detail {
+
+//------------------------------------------------------------------------------
+//--                               Conversions                                --
+//------------------------------------------------------------------------------
+
+namespace {
+    // Memory region for a value whose type is only known at runtime. Small
+    // values are stored inline, larger ones are allocated.
+    class DynamicMemory {
+    protected:
+        DynamicMemory(std::size_t size, std::size_t alignment)
+        : _allocated(nullptr) {
+            if(size <= sizeof(_inline) && alignment <= alignof(Inline)) {
+                _memory = &_inline;
+            } else {
+                std::size_t space = size + alignment;
+                _allocated = new unsigned char[space];
+                _memory = _allocated;
+                std::align(alignment, size, _memory, space);
+            }
+        }
+
+        ~DynamicMemory() { delete[] _allocated; }
+
+        using Inline = std::aligned_storage<64>::type;
+
+        Inline _inline;
+        unsigned char *_allocated;
+        void *_memory;
+    };
+
+    // Buffer for an intermediate value within a chain of conversions, into
+    // which the specified conversion can construct its target value.
+    class DynamicBuffer : private DynamicMemory, public Buffer<void> {
+    public:
+        explicit DynamicBuffer(Conversion const &conversion)
+        : DynamicMemory(conversion.getSize(), conversion.getAlignment())
+        , Buffer<void>(_memory)
+        , _conversion(conversion) { }
+
+        ~DynamicBuffer() {
+            if(isConstructed()) _conversion.destruct(_memory);
+        }
+
+        // Intermediate values are only ever constructed by conversions.
+        void *constructCopy(void const *) override { return nullptr; }
+
+    private:
+        Conversion const &_conversion;
+    };
+
+    // Apply the steps of path from index first up to (excluding) index last
+    // to value, and call finish with the resulting value. Intermediate values
+    // are constructed on the stack and live until finish returns.
+    // Temporary is true if value is an intermediate value that may be moved.
+    template <typename T_Result, typename T_Finish>
+    T_Result applySteps(ConversionPath const &path,
+                        std::size_t first, std::size_t last,
+                        void *value, bool temporary, T_Finish &finish) {
+        for(; first < last; ++first) {
+            ConversionPath::Step const &step = path.steps[first];
+            if(step.base) {
+                value = step.base->upcast(value);
+            } else {
+                DynamicBuffer buffer(*step.conversion);
+                void *converted = step.conversion->get(value, buffer);
+                return applySteps<T_Result>(path, first + 1, last,
+                                            converted, true, finish);
+            }
+        }
+        return finish(value, temporary);
+    }
+
+    // Retrieve value as the type associated with target, using only a single
+    // registered conversion.
+    void *convertDirect(TypeInfo const *source, void *value,
+                        TypeInfo const *target,
+                        bool referable, bool movable, Buffer<void> *buffer) {
+        // No conversion is necessary if source matches the target type.
+        if(source == target) {
+            // Return a reference to value if possible.
+            if(referable) {
+                return value;
+            // Otherwise, try to move or copy value into the target buffer.
+            } else if(buffer) {
+                void *copy = movable ? buffer->constructMove(value)
+                                     : buffer->constructCopy(value);
+                if(copy) return copy;
+            }
+        }
+
+        // If a target buffer is available, look for a registered conversion
+        // from source to the target type.
+        if(buffer) {
+            for(auto &&conversion : source->getConversions()) {
+                if(conversion.getTypeInfo() == target) {
+                    return conversion.get(value, *buffer);
+                }
+            }
+        }
+
+        // Recursively check base classes.
+        for(auto &&base : source->getBases()) {
+            void *converted = convertDirect(base.getTypeInfo(),
+                                            base.upcast(value), target,
+                                            referable, movable, buffer);
+            if(converted) return converted;
+        }
+
+        // No conversion found.
+        return nullptr;
+    }
+
+    // Convert value and copy-assign it to the accessed storage, using only a
+    // single registered conversion.
+    bool setDirect(Accessor const *accessor, Storage &storage,
+                   TypeInfo const *source, void const *value) {
+        // Look for a registered conversion from source to the accessed type.
+        for(auto &&conversion : source->getConversions()) {
+            if(conversion.getTypeInfo() == accessor->getTypeInfo()) {
+                if(conversion.set(accessor, storage, value)) {
+                    return true;
+                }
+            }
+        }
+
+        // Recursively check base classes.
+        for(auto &&base : source->getBases()) {
+            void const *upcast = base.upcast(value);
+            if(base.getTypeInfo() == accessor->getTypeInfo()) {
+                return accessor->set(storage, upcast);
+            }
+            if(setDirect(accessor, storage, base.getTypeInfo(), upcast)) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    // Convert value and move-assign it to the accessed storage, using only a
+    // single registered conversion.
+    bool moveDirect(Accessor const *accessor, Storage &storage,
+                    TypeInfo const *source, void *value) {
+        // Look for a registered conversion from source to the accessed type.
+        for(auto &&conversion : source->getConversions()) {
+            if(conversion.getTypeInfo() == accessor->getTypeInfo()) {
+                if(conversion.move(accessor, storage, value)) {
+                    return true;
+                }
+            }
+        }
+
+        // Recursively check base classes.
+        for(auto &&base : source->getBases()) {
+            void *upcast = base.upcast(value);
+            if(base.getTypeInfo() == accessor->getTypeInfo()) {
+                return accessor->move(storage, upcast);
+            }
+            if(moveDirect(accessor, storage, base.getTypeInfo(), upcast)) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    // Convert value along the cheapest chain of conversions and assign it to
+    // the accessed storage.
+    bool assignTransitive(Accessor const *accessor, Storage &storage,
+                          TypeInfo const *source, void *value, bool movable) {
+        ConversionPath const *path = findConversionPath(
+            source, accessor->getTypeInfo()
+        );
+        if(!path) return false;
+
+        std::size_t length = path->steps.size();
+        Conversion const *last = path->steps.back().conversion;
+        auto finish = [&](void *result, bool temporary) -> bool {
+            // Let the final conversion assign its result directly.
+            if(last) {
+                return temporary ? last->move(accessor, storage, result)
+                                 : last->set(accessor, storage, result);
+            }
+            // Otherwise, the final value is a base class of the last
+            // intermediate value.
+            return accessor->move(storage, result);
+        };
+        return applySteps<bool>(*path, 0, last ? length - 1 : length,
+                                value, movable, finish);
+    }
+}
+
+// Retrieve value, which must be of the type associated with source, as the
+// type associated with target.
+void *convert(TypeInfo const *source, void *value, TypeInfo const *target,
+              bool referable, bool movable, Buffer<void> *buffer) {
+    // Without a buffer, value can only be retrieved as its own type or one of
+    // its base classes.
+    if(!buffer && !isDerived(source, target)) return nullptr;
+
+    void *converted = convertDirect(source, value, target,
+                                    referable, movable, buffer);
+    if(converted || !buffer || !getTransitiveConversions()) {
+        return converted;
+    }
+
+    // Fall back to the cheapest chain of conversions.
+    ConversionPath const *path = findConversionPath(source, target);
+    if(!path) return nullptr;
+
+    std::size_t length = path->steps.size();
+    Conversion const *last = path->steps.back().conversion;
+    auto finish = [&](void *result, bool) -> void * {
+        // Construct the final value directly within the target buffer.
+        if(last) return last->get(result, *buffer);
+        // Otherwise, the final value is a base class of the last intermediate
+        // value.
+        return buffer->constructMove(result);
+    };
+    return applySteps<void *>(*path, 0, last ? length - 1 : length,
+                              value, movable, finish);
+}
+
+// Convert value from the type associated with source and copy-assign it to the
+// accessed storage.
+bool convertAndSet(Accessor const *accessor, Storage &storage,
+                   TypeInfo const *source, void const *value) {
+    if(setDirect(accessor, storage, source, value)) return true;
+    if(!getTransitiveConversions()) return false;
+
+    return assignTransitive(accessor, storage, source,
+                            const_cast<void *>(value), false);
+}
+
+// Convert value from the type associated with source and move-assign it to the
+// accessed storage.
+bool convertAndMove(Accessor const *accessor, Storage &storage,
+                    TypeInfo const *source, void *value) {
+    if(moveDirect(accessor, storage, source, value)) return true;
+    if(!getTransitiveConversions()) return false;
+
+    return assignTransitive(accessor, storage, source, value, true);
+}
+
+//---------------------------  Conversion Chains  ------------------------------
+
+namespace {
+    // Cheapest chains of conversions from a single source type.
+    struct ConversionPaths {
+        // Generation of the registered type graph the chains were computed
+        // from.
+        unsigned long generation;
+        // Chains ordered by increasing cost.
+        std::vector<ConversionPath> paths;
+        // Index of the chain leading to each target type.
+        std::unordered_map<TypeInfo const *, std::size_t> index;
+    };
+
+    // Compute the cheapest chains of conversions from source to all reachable
+    // types using Dijkstra's algorithm. Upcasts are free, and among chains of
+    // equal cost the one with fewer steps is preferred.
+    void computePaths(TypeInfo const *source, ConversionPaths &result) {
+        // Best known way of reaching a type.
+        struct Node {
+            unsigned cost;
+            std::size_t length;
+            TypeInfo const *previous;
+            ConversionPath::Step step;
+            bool converted;
+            bool settled;
+        };
+        std::unordered_map<TypeInfo const *, Node> nodes;
+
+        using Entry = std::tuple<unsigned, std::size_t, TypeInfo const *>;
+        std::priority_queue<Entry, std::vector<Entry>,
+                            std::greater<Entry>> queue;
+
+        nodes[source] = { 0, 0, nullptr, { nullptr, nullptr }, false, false };
+        queue.emplace(0, 0, source);
+
+        // Relax the edge from the type at current to next.
+        auto relax = [&](TypeInfo const *current, Node const &node,
+                         TypeInfo const *next, unsigned cost,
+                         ConversionPath::Step step) {
+            auto it = nodes.find(next);
+            if(it == nodes.end() ||
+               std::make_tuple(cost, node.length + 1)
+               < std::make_tuple(it->second.cost, it->second.length)) {
+                Node &target = nodes[next];
+                if(target.settled) return;
+                target = { cost, node.length + 1, current, step,
+                           node.converted || step.conversion, false };
+                queue.emplace(cost, node.length + 1, next);
+            }
+        };
+
+        std::vector<TypeInfo const *> order;
+        while(!queue.empty()) {
+            TypeInfo const *current = std::get<2>(queue.top());
+            queue.pop();
+
+            Node &node = nodes[current];
+            if(node.settled) continue;
+            node.settled = true;
+            if(node.converted) order.push_back(current);
+
+            Node const copy = node;
+            for(auto &&base : current->getBases()) {
+                relax(current, copy, base.getTypeInfo(), copy.cost,
+                      { &base, nullptr });
+            }
+            for(auto &&conversion : current->getConversions()) {
+                relax(current, copy, conversion.getTypeInfo(),
+                      copy.cost + conversion.getCost(),
+                      { nullptr, &conversion });
+            }
+        }
+
+        // Reconstruct the chains in order of increasing cost.
+        result.paths.clear();
+        result.index.clear();
+        for(TypeInfo const *target : order) {
+            Node const &node = nodes[target];
+            ConversionPath path { target, node.cost, { } };
+            path.steps.resize(node.length);
+            TypeInfo const *current = target;
+            for(std::size_t i = node.length; i > 0; --i) {
+                Node const &step = nodes[current];
+                path.steps[i - 1] = step.step;
+                current = step.previous;
+            }
+            result.index[target] = result.paths.size();
+            result.paths.push_back(std::move(path));
+        }
+    }
+}
+
+namespace {
+    // Precomputed chains of conversions shared by all threads.
+    struct InstalledPaths {
+        // Generation of the registered type graph the chains are valid for.
+        unsigned long generation;
+        // Chains from each source type.
+        std::unordered_map<TypeInfo const *, ConversionPaths> sources;
+    };
+
+    // Currently installed chains, or nullptr if none have been installed.
+    std::atomic<InstalledPaths const *> &installedPaths() {
+        static std::atomic<InstalledPaths const *> paths(nullptr);
+        return paths;
+    }
+
+    // Mutex serializing installation.
+    std::mutex &installMutex() {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    // All chains ever installed, which are retained since they may still be
+    // copied by concurrent readers.
+    std::vector<std::unique_ptr<InstalledPaths>> &installedMemory() {
+        static std::vector<std::unique_ptr<InstalledPaths>> memory;
+        return memory;
+    }
+
+    // Retrieve the cheapest chains of conversions from source, which are
+    // cached per thread and recomputed whenever the registered type graph
+    // changes.
+    ConversionPaths const &getPaths(TypeInfo const *source) {
+        static thread_local std::unordered_map<
+            TypeInfo const *, ConversionPaths
+        > cache;
+
+        unsigned long generation = TypeInfo::getGeneration();
+        auto it = cache.find(source);
+        if(it == cache.end()) {
+            it = cache.emplace(source, ConversionPaths()).first;
+        } else if(it->second.generation == generation) {
+            return it->second;
+        }
+
+        // Prefer installed chains if they match the registered type graph.
+        InstalledPaths const *installed = installedPaths().load(
+            std::memory_order_acquire
+        );
+        if(installed && installed->generation == generation &&
+           installed->sources.count(source)) {
+            it->second = installed->sources.at(source);
+        } else {
+            computePaths(source, it->second);
+        }
+        it->second.generation = generation;
+        return it->second;
+    }
+}
+
+// Install precomputed chains of conversions.
+void installConversionPaths(SourceConversionPaths paths,
+                            unsigned long generation) {
+    std::unique_ptr<InstalledPaths> installed(new InstalledPaths);
+    installed->generation = generation;
+    for(auto &&source : paths) {
+        ConversionPaths &result = installed->sources[source.first];
+        result.generation = generation;
+        result.paths = std::move(source.second);
+        for(std::size_t i = 0; i < result.paths.size(); ++i) {
+            result.index[result.paths[i].target] = i;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(installMutex());
+    installedPaths().store(installed.get(), std::memory_order_release);
+    installedMemory().push_back(std::move(installed));
+}
+
+// Retrieve the cheapest chains of conversions leading from source.
+std::vector<ConversionPath> const &getConversionPaths(TypeInfo const *source) {
+    return getPaths(source).paths;
+}
+
+// Retrieve the cheapest chain of conversions leading from source to target.
+ConversionPath const *findConversionPath(TypeInfo const *source,
+                                         TypeInfo const *target) {
+    ConversionPaths const &paths = getPaths(source);
+    auto it = paths.index.find(target);
+    if(it == paths.index.end()) return nullptr;
+    return &paths.paths[it->second];
+}
+
+//-----------------------------  Error Reporting  ------------------------------
+
+// Raise an error indicating that a value could not be retrieved.
+void raiseGetError(TypeInfo const *source, bool constant, bool reference,
+                   TypeInfo const *target, char const *qualifiers) {
+    raiseError(
+        "Could not retrieve type '" + source->getName()
+        + (constant ? " const" : "") + (reference ? " &" : "")
+        + "' as type '" + target->getName() + qualifiers + "'."
+    );
+}
+
+// Raise an error indicating that a value could not be set.
+void raiseSetError(TypeInfo const *target, bool constant, bool reference,
+                   TypeInfo const *source) {
+    raiseError(
+        "Could not set type '" + target->getName()
+        + (constant ? " const" : "") + (reference ? " &" : "")
+        + "' from type '" + source->getName() + "'."
+    );
+}
+
+} }
+//--                      End Namespace Reflect::Detail                       --
+//------------------------------------------------------------------------------
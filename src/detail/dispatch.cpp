@@ -0,0 +1,123 @@
+// Copyright (c) 2019 Johannes Zeppenfeld
+// SPDX-License-Identifier: MIT
+
+#include "reflect/detail/dispatch.h"
+
+#include "reflect/type.h"
+
+// std::hash
+#include <functional>
+// std::numeric_limits
+#include <limits>
+// std::tuple
+#include <tuple>
+// std::unordered_map
+#include <unordered_map>
+
+//------------------------------------------------------------------------------
+//--                     Begin Namespace Reflect::Detail                      --
+namespace Reflect { namespace Detail {
+
+//------------------------------------------------------------------------------
+//--                           Class DispatchTable                            --
+//------------------------------------------------------------------------------
+
+namespace {
+    // Cost assigned to the lack of any match.
+    constexpr unsigned NoMatch = std::numeric_limits<unsigned>::max();
+
+    // Cost of a registered conversion relative to an upcast by one level.
+    constexpr unsigned ConversionCost = 1u << 16;
+
+    // Determine the number of upcasts needed to get from source to target.
+    unsigned upcastCost(TypeInfo const *source, TypeInfo const *target) {
+        if(source == target) return 0;
+
+        unsigned cost = NoMatch;
+        for(auto &&base : source->getBases()) {
+            unsigned baseCost = upcastCost(base.getTypeInfo(), target);
+            if(baseCost < cost - 1) cost = baseCost + 1;
+        }
+        return cost;
+    }
+
+    // Determine the cost of converting from source to target using a
+    // registered conversion of source or one of its base classes.
+    unsigned conversionCost(TypeInfo const *source, TypeInfo const *target) {
+        for(auto &&conversion : source->getConversions()) {
+            if(conversion.getTypeInfo() == target) return ConversionCost;
+        }
+
+        unsigned cost = NoMatch;
+        for(auto &&base : source->getBases()) {
+            unsigned baseCost = conversionCost(base.getTypeInfo(), target);
+            if(baseCost < cost - 1) cost = baseCost + 1;
+        }
+        return cost;
+    }
+}
+
+// Find the candidate best matching the specified reflected type.
+DispatchTable::Entry const *DispatchTable::find(Type const &type) const {
+    // Resolved entries are cached per thread, keyed by dispatch table,
+    // reflected type and constness.
+    using Key = std::tuple<DispatchTable const *, TypeInfo const *, bool>;
+    struct Hash {
+        std::size_t operator()(Key const &key) const {
+            std::hash<void const *> hash;
+            return hash(std::get<0>(key)) * 31
+                 + hash(std::get<1>(key)) * 2
+                 + std::get<2>(key);
+        }
+    };
+    static thread_local std::unordered_map<Key, Entry, Hash> entries;
+
+    Key key { this, type.getTypeInfo(), type.isConstant() };
+    auto it = entries.find(key);
+    if(it == entries.end()) {
+        Entry entry;
+        if(!resolve(type, entry)) return nullptr;
+        it = entries.emplace(key, entry).first;
+    }
+    return &it->second;
+}
+
+// Determine the candidate best matching the specified reflected type.
+bool DispatchTable::resolve(Type const &type, Entry &entry) const {
+    TypeInfo const *typeInfo = type.getTypeInfo();
+
+    unsigned cost = NoMatch;
+    for(std::size_t i = 0; i < _candidates.size() && cost > 0; ++i) {
+        Candidate const &candidate = _candidates[i];
+
+        // Exact matches and upcasts can be passed by reference, so long as
+        // constness is preserved, or by value.
+        if(candidate.byReference || candidate.byValue) {
+            if(!candidate.mutableReference || !type.isConstant()) {
+                unsigned candidateCost = upcastCost(typeInfo,
+                                                    candidate.typeInfo);
+                if(candidateCost < cost) {
+                    cost = candidateCost;
+                    entry = { i, !candidate.byReference };
+                }
+            }
+        }
+
+        // Registered conversions produce a temporary that can only be passed
+        // by value.
+        if(candidate.byValue) {
+            unsigned candidateCost = conversionCost(typeInfo,
+                                                    candidate.typeInfo);
+            if(candidateCost < cost) {
+                cost = candidateCost;
+                entry = { i, true };
+            }
+        }
+    }
+
+    return cost != NoMatch;
+}
+
+} }
+//--                      End Namespace Reflect::Detail                       --
+//------------------------------------------------------------------------------
@@ -0,0 +1,85 @@
+// Copyright (c) 2019 Johannes Zeppenfeld
+// SPDX-License-Identifier: MIT
+
+#include "reflect/detail/dynamic_type.h"
+
+#if !defined(REFLECT_NO_RTTI)
+
+// std::atomic
+#include <atomic>
+// std::unique_ptr
+#include <memory>
+// std::mutex
+#include <mutex>
+// std::type_index
+#include <typeindex>
+// std::unordered_map
+#include <unordered_map>
+// std::vector
+#include <vector>
+
+//------------------------------------------------------------------------------
+//--                     Begin Namespace Reflect::Detail                      --
+namespace Reflect { namespace Detail {
+
+//------------------------------------------------------------------------------
+//--                              Dynamic Types                               --
+//------------------------------------------------------------------------------
+
+namespace {
+    // Registered types indexed by their std::type_info.
+    using DynamicTypes = std::unordered_map<std::type_index, DynamicType>;
+
+    // Current snapshot of the registered types. Registration publishes a new
+    // snapshot, so that lookups proceed without locking.
+    std::atomic<DynamicTypes const *> &dynamicTypes() {
+        static std::atomic<DynamicTypes const *> types(nullptr);
+        return types;
+    }
+
+    // Mutex serializing registration.
+    std::mutex &dynamicTypesMutex() {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    // All snapshots ever published, which are retained since they may still
+    // be in use by concurrent lookups.
+    std::vector<std::unique_ptr<DynamicTypes const>> &dynamicTypesSnapshots() {
+        static std::vector<std::unique_ptr<DynamicTypes const>> snapshots;
+        return snapshots;
+    }
+}
+
+// Register a type for lookup by its std::type_info.
+void registerDynamicType(std::type_info const &type,
+                         DynamicType const &dynamicType) {
+    std::lock_guard<std::mutex> lock(dynamicTypesMutex());
+
+    DynamicTypes const *types = dynamicTypes().load(std::memory_order_relaxed);
+    if(types && types->count(type)) return;
+
+    std::unique_ptr<DynamicTypes> snapshot(
+        types ? new DynamicTypes(*types) : new DynamicTypes()
+    );
+    snapshot->emplace(type, dynamicType);
+
+    DynamicTypes const *published = snapshot.get();
+    dynamicTypesSnapshots().push_back(std::move(snapshot));
+    dynamicTypes().store(published, std::memory_order_release);
+}
+
+// Look up the registered type with the specified std::type_info.
+DynamicType const *findDynamicType(std::type_info const &type) {
+    DynamicTypes const *types = dynamicTypes().load(std::memory_order_acquire);
+    if(!types) return nullptr;
+
+    auto it = types->find(type);
+    return it == types->end() ? nullptr : &it->second;
+}
+
+} }
+//--                      End Namespace Reflect::Detail                       --
+//------------------------------------------------------------------------------
+
+#endif
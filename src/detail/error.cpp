@@ -0,0 +1,42 @@
+// Copyright (c) 2019 Johannes Zeppenfeld
+// SPDX-License-Identifier: MIT
+
+#include "reflect/detail/error.h"
+
+#include "reflect/error.h"
+
+#if defined(REFLECT_NO_EXCEPTIONS)
+// std::fputs, stderr
+#include <cstdio>
+// std::abort
+#include <cstdlib>
+#else
+#include <stdexcept>
+#endif
+
+//------------------------------------------------------------------------------
+//--                     Begin Namespace Reflect::Detail                      --
+namespace Reflect { namespace Detail {
+
+//------------------------------------------------------------------------------
+//--                              Error Handling                              --
+//------------------------------------------------------------------------------
+
+// Report an error to the installed error handler.
+void raiseError(std::string const &message) {
+    if(ErrorHandler handler = getErrorHandler()) {
+        handler(message);
+    }
+
+#if defined(REFLECT_NO_EXCEPTIONS)
+    std::fputs(message.c_str(), stderr);
+    std::fputs("\n", stderr);
+    std::abort();
+#else
+    throw std::runtime_error(message);
+#endif
+}
+
+} }
+//--                      End Namespace Reflect::Detail                       --
+//------------------------------------------------------------------------------
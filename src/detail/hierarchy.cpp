@@ -0,0 +1,255 @@
+// Copyright (c) 2019 Johannes Zeppenfeld
+// SPDX-License-Identifier: MIT
+
+#include "reflect/detail/hierarchy.h"
+
+#include "reflect/detail/error.h"
+#include "reflect/detail/type_info.h"
+
+// std::atomic
+#include <atomic>
+// std::size_t
+#include <cstddef>
+// std::uint32_t, std::uint64_t
+#include <cstdint>
+// std::unique_ptr
+#include <memory>
+// std::mutex
+#include <mutex>
+// std::unordered_map
+#include <unordered_map>
+// std::pair
+#include <utility>
+// std::vector
+#include <vector>
+
+//------------------------------------------------------------------------------
+//--                     Begin Namespace Reflect::Detail                      --
+namespace Reflect { namespace Detail {
+
+//------------------------------------------------------------------------------
+//--                             Class Hierarchy                              --
+//------------------------------------------------------------------------------
+
+namespace {
+    // Marker of a type that does not store a bitset of its ancestors.
+    constexpr std::uint32_t NoRow = ~std::uint32_t(0);
+
+    // Position of a type within the index.
+    struct Node {
+        // Index of the type, identifying its bit within ancestor bitsets.
+        std::uint32_t index;
+        // Depth-first interval of the type within its tree, if its ancestors
+        // all have at most one base class.
+        std::uint32_t pre;
+        std::uint32_t post;
+        // Row of the type's ancestor bitset, or NoRow if the type is part of
+        // a tree.
+        std::uint32_t row;
+    };
+
+    // Immutable index of the registered base classes of all types.
+    struct Hierarchy {
+        // Generation of the registered type graph the index was built from.
+        unsigned long generation;
+        // Nodes of all types with base classes or derived types.
+        std::unordered_map<TypeInfo const *, Node> nodes;
+        // Ancestor bitsets, each consisting of rowWords words.
+        std::vector<std::uint64_t> bits;
+        std::size_t rowWords;
+    };
+
+    // Build the index of the currently registered base classes.
+    void buildHierarchy(Hierarchy &hierarchy) {
+        // Collect all types with base classes, as well as their ancestors.
+        std::vector<TypeInfo const *> types;
+        std::vector<std::vector<std::uint32_t>> bases;
+        auto add = [&](TypeInfo const *type) -> std::uint32_t {
+            auto result = hierarchy.nodes.emplace(
+                type, Node { std::uint32_t(types.size()), 0, 0, NoRow }
+            );
+            if(result.second) types.push_back(type);
+            return result.first->second.index;
+        };
+        for(TypeInfo const *type : TypeInfo::getRegisteredTypes()) {
+            add(type);
+        }
+        for(std::size_t i = 0; i < types.size(); ++i) {
+            std::vector<std::uint32_t> direct;
+            for(auto &&base : types[i]->getBases()) {
+                direct.push_back(add(base.getTypeInfo()));
+            }
+            bases.push_back(std::move(direct));
+        }
+
+        // Determine which types belong to trees, i.e., have no ancestor with
+        // multiple base classes. Cyclic registrations are treated as not
+        // belonging to a tree.
+        enum State : unsigned char { Unknown, Visiting, Tree, Graph };
+        std::vector<State> states(types.size(), Unknown);
+        for(std::size_t i = 0; i < types.size(); ++i) {
+            std::vector<std::size_t> chain;
+            std::size_t current = i;
+            while(states[current] == Unknown && bases[current].size() == 1) {
+                states[current] = Visiting;
+                chain.push_back(current);
+                current = bases[current].front();
+            }
+            State state = states[current];
+            if(state == Unknown) {
+                state = bases[current].empty() ? Tree : Graph;
+                states[current] = state;
+            } else if(state == Visiting) {
+                state = Graph;
+            }
+            for(std::size_t link : chain) states[link] = state;
+        }
+
+        // Number the trees in depth-first order.
+        std::vector<std::vector<std::uint32_t>> children(types.size());
+        for(std::size_t i = 0; i < types.size(); ++i) {
+            if(states[i] == Tree && !bases[i].empty()) {
+                children[bases[i].front()].push_back(std::uint32_t(i));
+            }
+        }
+        std::uint32_t counter = 0;
+        std::vector<std::pair<std::uint32_t, std::size_t>> stack;
+        for(std::size_t i = 0; i < types.size(); ++i) {
+            if(states[i] != Tree || !bases[i].empty()) continue;
+
+            hierarchy.nodes[types[i]].pre = counter++;
+            stack.emplace_back(std::uint32_t(i), 0);
+            while(!stack.empty()) {
+                std::uint32_t node = stack.back().first;
+                std::size_t &next = stack.back().second;
+                if(next < children[node].size()) {
+                    std::uint32_t child = children[node][next++];
+                    hierarchy.nodes[types[child]].pre = counter++;
+                    stack.emplace_back(child, 0);
+                } else {
+                    hierarchy.nodes[types[node]].post = counter++;
+                    stack.pop_back();
+                }
+            }
+        }
+
+        // Store the ancestors of all other types as bitsets.
+        hierarchy.rowWords = (types.size() + 63) / 64;
+        hierarchy.bits.clear();
+        std::uint32_t rows = 0;
+        for(std::size_t i = 0; i < types.size(); ++i) {
+            if(states[i] == Tree) continue;
+
+            std::size_t offset = hierarchy.bits.size();
+            hierarchy.bits.resize(offset + hierarchy.rowWords, 0);
+            hierarchy.nodes[types[i]].row = rows++;
+
+            std::vector<std::uint32_t> pending(bases[i]);
+            while(!pending.empty()) {
+                std::uint32_t ancestor = pending.back();
+                pending.pop_back();
+
+                std::uint64_t &word = hierarchy.bits[offset + ancestor / 64];
+                std::uint64_t bit = std::uint64_t(1) << (ancestor % 64);
+                if(word & bit) continue;
+                word |= bit;
+                pending.insert(pending.end(), bases[ancestor].begin(),
+                               bases[ancestor].end());
+            }
+        }
+    }
+
+    // Currently published index, or nullptr if none has been built.
+    std::atomic<Hierarchy const *> &currentHierarchy() {
+        static std::atomic<Hierarchy const *> hierarchy(nullptr);
+        return hierarchy;
+    }
+
+    // Mutex serializing publishing the index.
+    std::mutex &hierarchyMutex() {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    // All indices ever published, which are retained since they may still
+    // be in use by concurrent queries.
+    std::vector<std::unique_ptr<Hierarchy const>> &hierarchySnapshots() {
+        static std::vector<std::unique_ptr<Hierarchy const>> snapshots;
+        return snapshots;
+    }
+
+    // Retrieve the index of the current generation of the registered type
+    // graph, rebuilding it if necessary.
+    Hierarchy const &getHierarchy() {
+        Hierarchy const *hierarchy = currentHierarchy().load(
+            std::memory_order_acquire
+        );
+        if(hierarchy &&
+           hierarchy->generation == TypeInfo::getGeneration()) {
+            return *hierarchy;
+        }
+
+        // The index is built without holding the mutex, since building it
+        // may execute deferred registrations, which may in turn query the
+        // index. If the generation changes while building, the index is
+        // rebuilt for the resulting generation.
+        std::unique_ptr<Hierarchy> built;
+        unsigned long generation;
+        do {
+            generation = TypeInfo::getGeneration();
+            built.reset(new Hierarchy);
+            built->generation = generation;
+            buildHierarchy(*built);
+        } while(generation != TypeInfo::getGeneration());
+
+        std::lock_guard<std::mutex> lock(hierarchyMutex());
+        hierarchy = built.get();
+        hierarchySnapshots().emplace_back(std::move(built));
+        currentHierarchy().store(hierarchy, std::memory_order_release);
+        return *hierarchy;
+    }
+}
+
+// Returns true if derived is base or has base as a registered base class.
+bool isDerived(TypeInfo const *derived, TypeInfo const *base) {
+    if(derived == base) return true;
+
+    // Execute any deferred registrations of the derived type, so that its
+    // base classes are part of the index.
+    derived->beginBases();
+
+    Hierarchy const &hierarchy = getHierarchy();
+    auto derivedNode = hierarchy.nodes.find(derived);
+    auto baseNode = hierarchy.nodes.find(base);
+    if(derivedNode == hierarchy.nodes.end() ||
+       baseNode == hierarchy.nodes.end()) {
+        return false;
+    }
+
+    // All ancestors of a type within a tree are part of the same tree.
+    Node const &node = derivedNode->second;
+    Node const &ancestor = baseNode->second;
+    if(node.row == NoRow) {
+        return ancestor.row == NoRow &&
+               ancestor.pre <= node.pre && node.post <= ancestor.post;
+    }
+
+    std::uint64_t word = hierarchy.bits[node.row * hierarchy.rowWords
+                                        + ancestor.index / 64];
+    return (word >> (ancestor.index % 64)) & 1;
+}
+
+// Throw an exception unless derived is base or has base as a registered base
+// class.
+void verifyDerived(TypeInfo const *derived, TypeInfo const *base) {
+    if(!isDerived(derived, base)) {
+        raiseError(
+            "Type '" + derived->getName() + "' is not derived from type '"
+            + base->getName() + "'."
+        );
+    }
+}
+
+} }
+//--                      End Namespace Reflect::Detail                       --
+//------------------------------------------------------------------------------
@@ -0,0 +1,185 @@
+// Copyright (c) 2019 Johannes Zeppenfeld
+// SPDX-License-Identifier: MIT
+
+#include "reflect/detail/name_registry.h"
+
+#include "reflect/detail/error.h"
+#include "reflect/detail/type_info.h"
+
+// std::atomic
+#include <atomic>
+// std::memcmp
+#include <cstring>
+// std::deque
+#include <deque>
+// std::unique_ptr
+#include <memory>
+// std::mutex
+#include <mutex>
+
+//------------------------------------------------------------------------------
+//--                     Begin Namespace Reflect::Detail                      --
+namespace Reflect { namespace Detail {
+
+//------------------------------------------------------------------------------
+//--                              Name Registry                               --
+//------------------------------------------------------------------------------
+
+namespace {
+    // Open-addressing hash table of interned type names.
+    // Names are inserted by publishing them to unused slots, and the table is
+    // grown by publishing a new table, so that lookups proceed without
+    // locking while names are being registered.
+    class NameTable {
+    public:
+        // Interned name associated with type information.
+        struct Entry {
+            // Precomputed hash of the name.
+            std::uint64_t hash;
+            // Interned name.
+            std::string name;
+            // Type information associated with the name.
+            TypeInfo const *typeInfo;
+        };
+
+        NameTable() : _table(nullptr), _count(0) { }
+
+        // Find the entry of the specified name.
+        // Returns nullptr if the name is not contained in the table.
+        Entry const *find(std::uint64_t hash,
+                          char const *data, std::size_t size) const {
+            return find(_table.load(std::memory_order_acquire),
+                        hash, data, size);
+        }
+
+        // Insert the specified name unless it is already contained in the
+        // table. Returns the entry of the name.
+        Entry const &insert(std::uint64_t hash,
+                            char const *data, std::size_t size,
+                            TypeInfo const *typeInfo) {
+            std::lock_guard<std::mutex> lock(_mutex);
+
+            Table const *table = _table.load(std::memory_order_relaxed);
+            if(Entry const *entry = find(table, hash, data, size)) {
+                return *entry;
+            }
+
+            _entries.push_back({ hash, std::string(data, size), typeInfo });
+            Entry const &entry = _entries.back();
+
+            // Keep the load factor at or below one half.
+            if(!table || (_count + 1) * 2 > table->mask + 1) {
+                grow();
+            } else {
+                place(*table, entry);
+            }
+            ++_count;
+
+            return entry;
+        }
+
+    private:
+        // Slots of a table, whose number is a power of two.
+        struct Table {
+            std::size_t mask;
+            std::unique_ptr<std::atomic<Entry const *>[]> slots;
+        };
+
+        // Find the entry of the specified name within table.
+        static Entry const *find(Table const *table, std::uint64_t hash,
+                                 char const *data, std::size_t size) {
+            if(!table) return nullptr;
+
+            std::size_t mask = table->mask;
+            for(std::size_t i = hash & mask; ; i = (i + 1) & mask) {
+                Entry const *entry = table->slots[i].load(
+                    std::memory_order_acquire
+                );
+                if(!entry) return nullptr;
+                if(entry->hash == hash && entry->name.size() == size &&
+                   std::memcmp(entry->name.data(), data, size) == 0) {
+                    return entry;
+                }
+            }
+        }
+
+        // Publish entry in the first unused slot of its probe sequence.
+        static void place(Table const &table, Entry const &entry) {
+            std::size_t i = entry.hash & table.mask;
+            while(table.slots[i].load(std::memory_order_relaxed)) {
+                i = (i + 1) & table.mask;
+            }
+            table.slots[i].store(&entry, std::memory_order_release);
+        }
+
+        // Publish a table of twice the capacity containing all entries,
+        // rehashed using their precomputed hashes.
+        void grow() {
+            Table const *table = _table.load(std::memory_order_relaxed);
+            std::size_t size = table ? (table->mask + 1) * 2 : 64;
+
+            _tables.push_back(Table {
+                size - 1,
+                std::unique_ptr<std::atomic<Entry const *>[]>(
+                    new std::atomic<Entry const *>[size]
+                )
+            });
+            Table const &grown = _tables.back();
+            for(std::size_t i = 0; i < size; ++i) {
+                grown.slots[i].store(nullptr, std::memory_order_relaxed);
+            }
+            for(auto &&entry : _entries) {
+                place(grown, entry);
+            }
+
+            _table.store(&grown, std::memory_order_release);
+        }
+
+        // Current table.
+        std::atomic<Table const *> _table;
+        // Number of entries.
+        std::size_t _count;
+        // Entries of all interned names, whose addresses remain stable.
+        std::deque<Entry> _entries;
+        // All tables, which are retained for concurrent lookups.
+        std::deque<Table> _tables;
+        // Mutex serializing insertions.
+        std::mutex _mutex;
+    };
+
+    // Retrieve the global name table.
+    NameTable &nameTable() {
+        static NameTable table;
+        return table;
+    }
+}
+
+// Globally associate the specified name with the type associated with
+// typeInfo.
+std::string const &registerTypeName(char const *data, std::size_t size,
+                                    TypeInfo const *typeInfo) {
+    NameTable::Entry const &entry = nameTable().insert(
+        hashName(data, size), data, size, typeInfo
+    );
+    if(entry.typeInfo != typeInfo) {
+        // The name of the other type is not retrieved, since that could
+        // execute its deferred registrations while registration is
+        // serialized.
+        raiseError(
+            "Name '" + entry.name
+            + "' has already been registered for a different type."
+        );
+    }
+    return entry.name;
+}
+
+// Look up the type information globally associated with the specified name.
+TypeInfo const *findTypeName(char const *data, std::size_t size) {
+    NameTable::Entry const *entry = nameTable().find(hashName(data, size),
+                                                     data, size);
+    return entry ? entry->typeInfo : nullptr;
+}
+
+} }
+//--                      End Namespace Reflect::Detail                       --
+//------------------------------------------------------------------------------
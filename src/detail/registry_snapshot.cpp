@@ -0,0 +1,358 @@
+// Copyright (c) 2019 Johannes Zeppenfeld
+// SPDX-License-Identifier: MIT
+
+#include "reflect/detail/registry_snapshot.h"
+
+#include "reflect/detail/error.h"
+#include "reflect/detail/convert.h"
+#include "reflect/detail/type_info.h"
+
+// std::sort
+#include <algorithm>
+// std::size_t
+#include <cstddef>
+// std::uint32_t, std::uint64_t
+#include <cstdint>
+// std::memcmp, std::memcpy
+#include <cstring>
+// std::ifstream, std::ofstream
+#include <fstream>
+// std::istreambuf_iterator
+#include <iterator>
+// std::unordered_map
+#include <unordered_map>
+// std::pair
+#include <utility>
+#include <vector>
+
+//------------------------------------------------------------------------------
+//--                     Begin Namespace Reflect::Detail                      --
+namespace Reflect { namespace Detail {
+
+//------------------------------------------------------------------------------
+//--                            Registry Snapshot                             --
+//------------------------------------------------------------------------------
+
+namespace {
+    // Identification of snapshot files.
+    constexpr char Magic[8] = { 'R', 'E', 'F', 'L', 'S', 'N', 'A', 'P' };
+    // Version of the snapshot format, incremented on incompatible changes.
+    constexpr std::uint32_t Version = 1;
+    // Value identifying the byte order of the platform writing the snapshot.
+    constexpr std::uint32_t ByteOrder = 0x01020304;
+
+    // Header at the beginning of a snapshot file. It is followed by the
+    // hashes of all types, ordered by increasing value, and the chains of
+    // conversions of each source type.
+    struct Header {
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t byteOrder;
+        std::uint32_t pointerSize;
+        std::uint32_t typeCount;
+        std::uint64_t fingerprint;
+        std::uint32_t sourceCount;
+        std::uint32_t reserved;
+    };
+
+    // Registered type graph, with types identified by their index when
+    // ordered by their hashes.
+    struct Graph {
+        std::vector<TypeInfo const *> types;
+        std::vector<std::uint64_t> hashes;
+        std::unordered_map<TypeInfo const *, std::uint32_t> index;
+        // Types for which base classes or conversions have been registered.
+        std::vector<TypeInfo const *> sources;
+        // Hash of the structure of the graph.
+        std::uint64_t fingerprint;
+    };
+
+    // Combine value into the 64-bit FNV-1a hash.
+    void combine(std::uint64_t &hash, std::uint64_t value) {
+        for(int i = 0; i < 8; ++i) {
+            hash ^= (value >> (i * 8)) & 0xff;
+            hash *= 0x100000001b3ull;
+        }
+    }
+
+    // Collect the currently registered type graph.
+    // Returns false if two types have the same hash.
+    bool collectGraph(Graph &graph) {
+        graph.sources = TypeInfo::getRegisteredTypes();
+        graph.index.clear();
+
+        // Include all types referenced by base classes and conversions.
+        std::vector<std::pair<std::uint64_t, TypeInfo const *>> types;
+        auto add = [&](TypeInfo const *type) {
+            if(graph.index.emplace(type, 0).second) {
+                types.emplace_back(type->getHash(), type);
+            }
+        };
+        for(TypeInfo const *source : graph.sources) {
+            add(source);
+            for(auto &&base : source->getBases()) {
+                add(base.getTypeInfo());
+            }
+            for(auto &&conversion : source->getConversions()) {
+                add(conversion.getTypeInfo());
+            }
+        }
+
+        std::sort(types.begin(), types.end(),
+                  [](std::pair<std::uint64_t, TypeInfo const *> const &lhs,
+                     std::pair<std::uint64_t, TypeInfo const *> const &rhs) {
+                      return lhs.first < rhs.first;
+                  });
+
+        graph.types.clear();
+        graph.hashes.clear();
+        for(std::size_t i = 0; i < types.size(); ++i) {
+            if(i > 0 && types[i].first == types[i - 1].first) return false;
+            graph.hashes.push_back(types[i].first);
+            graph.types.push_back(types[i].second);
+            graph.index[types[i].second] = static_cast<std::uint32_t>(i);
+        }
+
+        // Hash the base classes and conversions of all types in order.
+        graph.fingerprint = 0xcbf29ce484222325ull;
+        for(std::size_t i = 0; i < graph.types.size(); ++i) {
+            TypeInfo const *type = graph.types[i];
+            combine(graph.fingerprint, graph.hashes[i]);
+
+            auto bases = type->getBases();
+            combine(graph.fingerprint, bases.end() - bases.begin());
+            for(auto &&base : bases) {
+                combine(graph.fingerprint, graph.index[base.getTypeInfo()]);
+            }
+
+            auto conversions = type->getConversions();
+            combine(graph.fingerprint, conversions.end() - conversions.begin());
+            for(auto &&conversion : conversions) {
+                combine(graph.fingerprint,
+                        graph.index[conversion.getTypeInfo()]);
+                combine(graph.fingerprint, conversion.getCost());
+            }
+        }
+        return true;
+    }
+
+    // Append value to buffer.
+    template <typename T>
+    void write(std::vector<unsigned char> &buffer, T const &value) {
+        unsigned char const *bytes
+            = reinterpret_cast<unsigned char const *>(&value);
+        buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+    }
+
+    // Sequential reader of a snapshot.
+    class Reader {
+    public:
+        Reader(unsigned char const *begin, unsigned char const *end)
+        : _position(begin)
+        , _end(end) { }
+
+        // Read the next value. Returns false if the snapshot is truncated.
+        template <typename T>
+        bool read(T &value) {
+            if(static_cast<std::size_t>(_end - _position) < sizeof(T)) {
+                return false;
+            }
+            std::memcpy(&value, _position, sizeof(T));
+            _position += sizeof(T);
+            return true;
+        }
+
+        // Returns true if the entire snapshot has been read.
+        bool atEnd() const { return _position == _end; }
+
+    private:
+        unsigned char const *_position;
+        unsigned char const *_end;
+    };
+
+    // Encode a step of a chain of conversions leaving from type as the index
+    // of the base class or conversion within the type, with the lowest bit
+    // set for conversions.
+    std::uint32_t encodeStep(TypeInfo const *type,
+                             ConversionPath::Step const &step) {
+        // The step may refer to a base class or conversion of a previous
+        // snapshot of the type, so it is identified by its target.
+        std::uint32_t index = 0;
+        if(step.base) {
+            for(auto &&base : type->getBases()) {
+                if(base.getTypeInfo() == step.base->getTypeInfo()) break;
+                ++index;
+            }
+            return index << 1;
+        }
+        for(auto &&conversion : type->getConversions()) {
+            if(conversion.getTypeInfo() == step.conversion->getTypeInfo() &&
+               conversion.getCost() == step.conversion->getCost()) {
+                break;
+            }
+            ++index;
+        }
+        return (index << 1) | 1;
+    }
+
+    // Decode a step of a chain of conversions leaving from type, advancing
+    // type to the type reached by the step.
+    // Returns false if the step does not exist.
+    bool decodeStep(TypeInfo const *&type, std::uint32_t encoded,
+                    ConversionPath::Step &step) {
+        std::size_t index = encoded >> 1;
+        if(encoded & 1) {
+            auto conversions = type->getConversions();
+            if(index >= std::size_t(conversions.end() - conversions.begin())) {
+                return false;
+            }
+            step = { nullptr, conversions.begin() + index };
+            type = step.conversion->getTypeInfo();
+        } else {
+            auto bases = type->getBases();
+            if(index >= std::size_t(bases.end() - bases.begin())) {
+                return false;
+            }
+            step = { bases.begin() + index, nullptr };
+            type = step.base->getTypeInfo();
+        }
+        return true;
+    }
+}
+
+// Write a snapshot of the currently registered type graph to a file.
+void saveRegistrySnapshot(std::string const &path) {
+    Graph graph;
+    if(!collectGraph(graph)) {
+        raiseError(
+            "Could not write registry snapshot '" + path
+            + "', since two types have the same hash."
+        );
+    }
+
+    Header header;
+    std::memcpy(header.magic, Magic, sizeof(Magic));
+    header.version = Version;
+    header.byteOrder = ByteOrder;
+    header.pointerSize = sizeof(void *);
+    header.typeCount = static_cast<std::uint32_t>(graph.types.size());
+    header.fingerprint = graph.fingerprint;
+    header.sourceCount = static_cast<std::uint32_t>(graph.sources.size());
+    header.reserved = 0;
+
+    std::vector<unsigned char> buffer;
+    write(buffer, header);
+    for(std::uint64_t hash : graph.hashes) {
+        write(buffer, hash);
+    }
+
+    for(TypeInfo const *source : graph.sources) {
+        std::vector<ConversionPath> const &paths = getConversionPaths(source);
+        write(buffer, graph.index[source]);
+        write(buffer, static_cast<std::uint32_t>(paths.size()));
+        for(auto &&path : paths) {
+            write(buffer, graph.index[path.target]);
+            write(buffer, static_cast<std::uint32_t>(path.cost));
+            write(buffer, static_cast<std::uint32_t>(path.steps.size()));
+
+            TypeInfo const *type = source;
+            for(auto &&step : path.steps) {
+                write(buffer, encodeStep(type, step));
+                type = step.base ? step.base->getTypeInfo()
+                                 : step.conversion->getTypeInfo();
+            }
+        }
+    }
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<char const *>(buffer.data()),
+               static_cast<std::streamsize>(buffer.size()));
+    if(!file) {
+        raiseError(
+            "Could not write registry snapshot '" + path + "'."
+        );
+    }
+}
+
+// Read a snapshot from a file and install the chains of conversions it
+// contains if it matches the registered type graph.
+bool loadRegistrySnapshot(std::string const &path) {
+    std::ifstream file(path, std::ios::binary);
+    if(!file) return false;
+    std::vector<unsigned char> buffer(
+        (std::istreambuf_iterator<char>(file)),
+        std::istreambuf_iterator<char>()
+    );
+    Reader reader(buffer.data(), buffer.data() + buffer.size());
+
+    Header header;
+    if(!reader.read(header) ||
+       std::memcmp(header.magic, Magic, sizeof(Magic)) != 0 ||
+       header.version != Version || header.byteOrder != ByteOrder ||
+       header.pointerSize != sizeof(void *)) {
+        return false;
+    }
+
+    // Collecting the graph may execute deferred registrations, in which case
+    // it is collected again for the resulting generation.
+    Graph graph;
+    unsigned long generation = TypeInfo::getGeneration();
+    if(!collectGraph(graph)) return false;
+    if(generation != TypeInfo::getGeneration()) {
+        generation = TypeInfo::getGeneration();
+        if(!collectGraph(graph) || generation != TypeInfo::getGeneration()) {
+            return false;
+        }
+    }
+
+    if(header.typeCount != graph.types.size() ||
+       header.fingerprint != graph.fingerprint) {
+        return false;
+    }
+    for(std::uint64_t hash : graph.hashes) {
+        std::uint64_t stored;
+        if(!reader.read(stored) || stored != hash) return false;
+    }
+
+    SourceConversionPaths sources;
+    for(std::uint32_t i = 0; i < header.sourceCount; ++i) {
+        std::uint32_t source, count;
+        if(!reader.read(source) || !reader.read(count) ||
+           source >= graph.types.size()) {
+            return false;
+        }
+
+        sources.emplace_back(graph.types[source],
+                             std::vector<ConversionPath>());
+        std::vector<ConversionPath> &paths = sources.back().second;
+        for(std::uint32_t j = 0; j < count; ++j) {
+            std::uint32_t target, cost, length;
+            if(!reader.read(target) || !reader.read(cost) ||
+               !reader.read(length) || target >= graph.types.size()) {
+                return false;
+            }
+
+            ConversionPath path { graph.types[target], cost, { } };
+            TypeInfo const *type = graph.types[source];
+            for(std::uint32_t k = 0; k < length; ++k) {
+                std::uint32_t encoded;
+                ConversionPath::Step step;
+                if(!reader.read(encoded) ||
+                   !decodeStep(type, encoded, step)) {
+                    return false;
+                }
+                path.steps.push_back(step);
+            }
+            if(type != path.target || path.steps.empty()) return false;
+            paths.push_back(std::move(path));
+        }
+    }
+    if(!reader.atEnd()) return false;
+
+    installConversionPaths(std::move(sources), generation);
+    return true;
+}
+
+} }
+//--                      End Namespace Reflect::Detail                       --
+//------------------------------------------------------------------------------
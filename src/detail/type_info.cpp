@@ -0,0 +1,484 @@
+// Copyright (c) 2019 Johannes Zeppenfeld
+// SPDX-License-Identifier: MIT
+
+#include "reflect/detail/type_info.h"
+
+#include "reflect/detail/name_registry.h"
+#include "reflect/detail/static_registration.h"
+
+// std::min
+#include <algorithm>
+// std::size_t
+#include <cstddef>
+// std::strlen
+#include <cstring>
+// std::uintptr_t
+#include <cstdint>
+// std::uninitialized_copy, std::unique_ptr
+#include <memory>
+// std::mutex
+#include <mutex>
+// placement new
+#include <new>
+// std::unordered_map
+#include <unordered_map>
+// std::vector
+#include <vector>
+
+//------------------------------------------------------------------------------
+//--                     Begin Namespace Reflect::Detail                      --
+namespace Reflect { namespace Detail {
+
+//------------------------------------------------------------------------------
+//--                              Class TypeInfo                              --
+//------------------------------------------------------------------------------
+
+namespace {
+    // Alignment of snapshots, chosen to match a cache line.
+    constexpr std::size_t CacheLineSize = 64;
+
+    // Mutex serializing registration.
+    std::mutex &registrationMutex() {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    // Mutex serializing the execution of deferred registrations, which may
+    // retrieve information about the type being registered.
+    std::recursive_mutex &deferredMutex() {
+        static std::recursive_mutex mutex;
+        return mutex;
+    }
+
+    // Returns true if the implementation-defined name denotes a type with
+    // internal or no linkage, such as a type within an anonymous namespace or
+    // local to a function, which may share its name with distinct types
+    // defined elsewhere.
+    bool isLocalTypeName(std::string const &name) {
+        return name.find("anonymous") != std::string::npos ||
+               name.find("_GLOBAL__N") != std::string::npos ||
+               name.find(")::") != std::string::npos ||
+               // Itanium ABI mangling of local entities.
+               (!name.empty() && name.front() == 'Z');
+    }
+
+    // Hash of an implementation-defined name.
+    struct NameHash {
+        std::size_t operator()(std::string const &name) const {
+            return std::size_t(hashName(name.data(), name.size()));
+        }
+    };
+
+    // Mutex serializing the creation of type information instances.
+    std::mutex &instanceMutex() {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    // Type information instances indexed by their implementation-defined
+    // names, excluding those of local types.
+    std::unordered_map<std::string, TypeInfo *, NameHash> &canonicalTypes() {
+        static std::unordered_map<std::string, TypeInfo *, NameHash> types;
+        return types;
+    }
+
+    // All type information instances ever created, which are retained for
+    // the remainder of the program.
+    std::vector<std::unique_ptr<TypeInfo>> &typeInfoInstances() {
+        static std::vector<std::unique_ptr<TypeInfo>> instances;
+        return instances;
+    }
+
+    // Types for which base classes or conversions have been registered.
+    std::vector<TypeInfo *> &trackedTypes() {
+        static std::vector<TypeInfo *> types;
+        return types;
+    }
+
+    // Memory holding all snapshots ever published, which is retained since
+    // snapshots may still be in use by concurrent readers.
+    std::vector<std::unique_ptr<unsigned char[]>> &snapshotMemory() {
+        static std::vector<std::unique_ptr<unsigned char[]>> memory;
+        return memory;
+    }
+
+    // Round offset up to the next multiple of alignment.
+    std::size_t alignUp(std::size_t offset, std::size_t alignment) {
+        return (offset + alignment - 1) / alignment * alignment;
+    }
+
+    // Allocate a cache-line aligned block of at least size bytes, which is
+    // retained for the remainder of the program.
+    unsigned char *allocateSnapshot(std::size_t size) {
+        std::unique_ptr<unsigned char[]> memory(
+            new unsigned char[size + CacheLineSize]
+        );
+        std::uintptr_t address = reinterpret_cast<std::uintptr_t>(
+            memory.get()
+        );
+        unsigned char *aligned = memory.get()
+                               + (alignUp(address, CacheLineSize) - address);
+
+        snapshotMemory().push_back(std::move(memory));
+        return aligned;
+    }
+
+    // Reserve space for count elements of type T at offset, advancing offset
+    // past the reserved elements. Returns the offset of the first element.
+    template <typename T>
+    std::size_t reserve(std::size_t &offset, std::size_t count) {
+        offset = alignUp(offset, alignof(T));
+        std::size_t result = offset;
+        offset += count * sizeof(T);
+        return result;
+    }
+
+    // Copy the range of elements [begin, end) followed by the element pointed
+    // to by extra, if any, to memory.
+    template <typename T>
+    T *place(unsigned char *memory, T const *begin, T const *end,
+             T const *extra) {
+        T *result = reinterpret_cast<T *>(memory);
+        T *last = std::uninitialized_copy(begin, end, result);
+        if(extra) new (last) T(*extra);
+        return result;
+    }
+}
+
+//-------------------------------  Registration  -------------------------------
+
+// Retrieve the process-wide type information instance of the type with the
+// specified implementation-defined name.
+TypeInfo *TypeInfo::canonicalInstance(std::string name, Layout const &layout) {
+    std::lock_guard<std::mutex> lock(instanceMutex());
+
+    bool local = isLocalTypeName(name);
+    if(!local) {
+        auto it = canonicalTypes().find(name);
+        if(it != canonicalTypes().end()) return it->second;
+    }
+
+    std::unique_ptr<TypeInfo> instance(new TypeInfo(name, layout));
+    TypeInfo *typeInfo = instance.get();
+    typeInfoInstances().push_back(std::move(instance));
+    if(!local) canonicalTypes().emplace(std::move(name), typeInfo);
+    return typeInfo;
+}
+
+// Register a name for the type.
+void TypeInfo::registerName(std::string name) {
+    std::lock_guard<std::mutex> lock(registrationMutex());
+    internName(name.data(), name.size());
+}
+
+// Defer the specified registration until information about the type is first
+// retrieved.
+void TypeInfo::registerDeferred(Deferred &deferred) {
+    std::lock_guard<std::recursive_mutex> lock(deferredMutex());
+    deferred.next = _deferred;
+    _deferred = &deferred;
+    _deferredPending.store(true, std::memory_order_release);
+}
+
+// Register the information described by the specified array of types.
+void TypeInfo::registerStatic(StaticType const *types, std::size_t count) {
+    std::lock_guard<std::mutex> lock(registrationMutex());
+
+    // Register all names before any base classes or conversions, so that a
+    // conflicting name leaves the type graph unchanged.
+    for(std::size_t i = 0; i < count; ++i) {
+        if(types[i].name) {
+            types[i].typeInfo()->internName(types[i].name,
+                                            std::strlen(types[i].name));
+        }
+    }
+    for(std::size_t i = 0; i < count; ++i) {
+        types[i].registerDynamicType();
+    }
+
+    // Determine the size of the block holding the snapshot, base classes and
+    // conversions of each type.
+    std::size_t size = 0;
+    for(std::size_t i = 0; i < count; ++i) {
+        StaticType const &type = types[i];
+        Entries const *entries = type.typeInfo()->_entries.load(
+            std::memory_order_relaxed
+        );
+        reserve<Entries>(size, 1);
+        reserve<Base>(size, (entries->basesEnd - entries->basesBegin)
+                            + type.baseCount);
+        reserve<Conversion>(size, (entries->conversionsEnd
+                                   - entries->conversionsBegin)
+                                  + type.conversionCount);
+    }
+
+    unsigned char *memory = allocateSnapshot(size);
+
+    std::size_t offset = 0;
+    for(std::size_t i = 0; i < count; ++i) {
+        StaticType const &type = types[i];
+        TypeInfo *typeInfo = type.typeInfo();
+        Entries const *entries = typeInfo->_entries.load(
+            std::memory_order_relaxed
+        );
+        if(entries == &noEntries()) {
+            trackedTypes().push_back(typeInfo);
+        }
+
+        Entries *snapshot = new (memory + reserve<Entries>(offset, 1))
+            Entries;
+
+        // Append the described base classes to those already registered.
+        std::size_t bases = entries->basesEnd - entries->basesBegin;
+        Base *base = place<Base>(
+            memory + reserve<Base>(offset, bases + type.baseCount),
+            entries->basesBegin, entries->basesEnd, nullptr
+        );
+        snapshot->basesBegin = base;
+        base += bases;
+        for(std::size_t j = 0; j < type.baseCount; ++j) {
+            StaticBase const &described = type.bases[j];
+            new (base++) Base(described.typeInfo(), described.upcast);
+        }
+        snapshot->basesEnd = base;
+
+        // Append the described conversions to those already registered.
+        std::size_t conversions = entries->conversionsEnd
+                                - entries->conversionsBegin;
+        Conversion *conversion = place<Conversion>(
+            memory + reserve<Conversion>(offset,
+                                         conversions + type.conversionCount),
+            entries->conversionsBegin, entries->conversionsEnd, nullptr
+        );
+        snapshot->conversionsBegin = conversion;
+        conversion += conversions;
+        for(std::size_t j = 0; j < type.conversionCount; ++j) {
+            StaticConversion const &described = type.conversions[j];
+            new (conversion++) Conversion(
+                described.typeInfo(), described.get, described.set,
+                described.move, described.destruct, described.size,
+                described.alignment, described.cost
+            );
+        }
+        snapshot->conversionsEnd = conversion;
+
+        typeInfo->_entries.store(snapshot, std::memory_order_release);
+    }
+
+    frozen().store(false, std::memory_order_release);
+    generation().fetch_add(1, std::memory_order_acq_rel);
+}
+
+// Register a base class for the type.
+void TypeInfo::registerBase(Base base) {
+    std::lock_guard<std::mutex> lock(registrationMutex());
+    publish(&base, nullptr);
+}
+
+// Register a conversion from the type to another.
+void TypeInfo::registerConversion(Conversion conversion) {
+    std::lock_guard<std::mutex> lock(registrationMutex());
+    publish(nullptr, &conversion);
+}
+
+// Compact the registered base classes and conversions of all types.
+void TypeInfo::freeze() {
+    std::lock_guard<std::mutex> lock(registrationMutex());
+    if(frozen().load(std::memory_order_relaxed)) return;
+
+    // Determine the size of the compacted registry, keeping the snapshot,
+    // base classes and conversions of each type adjacent to one another.
+    std::size_t size = 0;
+    for(TypeInfo *type : trackedTypes()) {
+        Entries const *entries = type->_entries.load(
+            std::memory_order_relaxed
+        );
+        reserve<Entries>(size, 1);
+        reserve<Base>(size, entries->basesEnd - entries->basesBegin);
+        reserve<Conversion>(size, entries->conversionsEnd
+                                  - entries->conversionsBegin);
+    }
+
+    unsigned char *memory = allocateSnapshot(size);
+
+    std::size_t offset = 0;
+    for(TypeInfo *type : trackedTypes()) {
+        Entries const *entries = type->_entries.load(
+            std::memory_order_relaxed
+        );
+        Entries *compacted = new (memory + reserve<Entries>(offset, 1))
+            Entries;
+
+        std::size_t bases = entries->basesEnd - entries->basesBegin;
+        compacted->basesBegin = place<Base>(
+            memory + reserve<Base>(offset, bases),
+            entries->basesBegin, entries->basesEnd, nullptr
+        );
+        compacted->basesEnd = compacted->basesBegin + bases;
+
+        std::size_t conversions = entries->conversionsEnd
+                                - entries->conversionsBegin;
+        compacted->conversionsBegin = place<Conversion>(
+            memory + reserve<Conversion>(offset, conversions),
+            entries->conversionsBegin, entries->conversionsEnd, nullptr
+        );
+        compacted->conversionsEnd = compacted->conversionsBegin + conversions;
+
+        type->_entries.store(compacted, std::memory_order_release);
+    }
+
+    frozen().store(true, std::memory_order_release);
+}
+
+// Retrieve all types for which base classes or conversions have been
+// registered.
+std::vector<TypeInfo const *> TypeInfo::getRegisteredTypes() {
+    std::lock_guard<std::mutex> lock(registrationMutex());
+    return { trackedTypes().begin(), trackedTypes().end() };
+}
+
+// Execute deferred registrations.
+void TypeInfo::executeDeferred() const {
+    std::lock_guard<std::recursive_mutex> lock(deferredMutex());
+
+    // Information retrieved by a deferred registration of this type reflects
+    // whatever has been registered so far.
+    if(_deferredRunning) return;
+    _deferredRunning = true;
+
+    // Execute in the order deferred, including registrations deferred while
+    // executing.
+    while(Deferred *deferred = _deferred) {
+        _deferred = nullptr;
+
+        Deferred *ordered = nullptr;
+        while(deferred) {
+            Deferred *next = deferred->next;
+            deferred->next = ordered;
+            ordered = deferred;
+            deferred = next;
+        }
+
+        while(ordered) {
+            Deferred *current = ordered;
+            ordered = ordered->next;
+#if defined(REFLECT_NO_EXCEPTIONS)
+            current->registration();
+#else
+            try {
+                current->registration();
+            } catch(...) {
+                // Keep the remaining registrations pending, ahead of any
+                // deferred while executing.
+                Deferred **tail = &_deferred;
+                while(*tail) tail = &(*tail)->next;
+                while(ordered) {
+                    Deferred *next = ordered->next;
+                    ordered->next = *tail;
+                    *tail = ordered;
+                    ordered = next;
+                }
+                _deferredRunning = false;
+                throw;
+            }
+#endif
+        }
+    }
+
+    _deferredRunning = false;
+    _deferredPending.store(false, std::memory_order_release);
+}
+
+// Register a name for the type.
+void TypeInfo::internName(char const *name, std::size_t size) {
+    // Associate the name globally first, leaving the type unchanged if the
+    // name is already in use by a different type.
+    std::string const &interned = registerTypeName(name, size, this);
+
+    std::string const *current = _name.load(std::memory_order_relaxed);
+    if(current == &_typeName) {
+        _hash.store(hashName(name, size), std::memory_order_release);
+    }
+    if(current == &_typeName || interned.size() < current->size()) {
+        _name.store(&interned, std::memory_order_release);
+    }
+}
+
+#if defined(REFLECT_NO_RTTI)
+// Extract the name of a type from the signature of TypeInfo::signature.
+std::string TypeInfo::extractTypeName(char const *signature) {
+    std::string name(signature);
+
+#if defined(_MSC_VER)
+    // The signature is of the form "... signature<NAME>(void)", where class
+    // types are prefixed by their kind.
+    std::size_t begin = name.find("signature<");
+    std::size_t end = name.rfind(">(");
+    if(begin == std::string::npos || end == std::string::npos) return name;
+    name = name.substr(begin + 10, end - begin - 10);
+
+    for(char const *prefix : { "struct ", "class ", "enum ", "union " }) {
+        std::size_t length = std::strlen(prefix);
+        for(std::size_t pos = name.find(prefix); pos != std::string::npos;
+            pos = name.find(prefix, pos)) {
+            name.erase(pos, length);
+        }
+    }
+#else
+    // The signature is of the form "... [with T = NAME]" for GCC and
+    // "... [T = NAME]" for Clang, possibly followed by further aliases
+    // separated by a semicolon.
+    std::size_t begin = name.find("T = ", name.find('['));
+    std::size_t end = name.rfind(']');
+    if(begin == std::string::npos || end == std::string::npos) return name;
+    begin += 4;
+    end = std::min(end, name.find("; ", begin));
+    name = name.substr(begin, end - begin);
+#endif
+
+    return name;
+}
+#endif
+
+// Publish a new snapshot of the type containing the current base classes and
+// conversions, as well as the specified base class and conversion, if any.
+void TypeInfo::publish(Base const *base, Conversion const *conversion) {
+    Entries const *entries = _entries.load(std::memory_order_relaxed);
+    if(entries == &noEntries()) {
+        trackedTypes().push_back(this);
+    }
+
+    std::size_t bases = (entries->basesEnd - entries->basesBegin)
+                      + (base ? 1 : 0);
+    std::size_t conversions = (entries->conversionsEnd
+                               - entries->conversionsBegin)
+                            + (conversion ? 1 : 0);
+
+    std::size_t size = 0;
+    std::size_t entriesOffset = reserve<Entries>(size, 1);
+    std::size_t basesOffset = reserve<Base>(size, bases);
+    std::size_t conversionsOffset = reserve<Conversion>(size, conversions);
+    unsigned char *memory = allocateSnapshot(size);
+
+    Entries *snapshot = new (memory + entriesOffset) Entries;
+    snapshot->basesBegin = place(memory + basesOffset,
+                                 entries->basesBegin, entries->basesEnd,
+                                 base);
+    snapshot->basesEnd = snapshot->basesBegin + bases;
+    snapshot->conversionsBegin = place(memory + conversionsOffset,
+                                       entries->conversionsBegin,
+                                       entries->conversionsEnd,
+                                       conversion);
+    snapshot->conversionsEnd = snapshot->conversionsBegin + conversions;
+
+    _entries.store(snapshot, std::memory_order_release);
+    frozen().store(false, std::memory_order_release);
+
+    // Advance the generation only after publishing the snapshot, so that
+    // information derived for the new generation reflects the snapshot.
+    generation().fetch_add(1, std::memory_order_acq_rel);
+}
+
+} }
+//--                      End Namespace Reflect::Detail                       --
+//------------------------------------------------------------------------------
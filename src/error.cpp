@@ -0,0 +1,34 @@
+// Copyright (c) 2019 Johannes Zeppenfeld
+// SPDX-License-Identifier: MIT
+
+#include "reflect/error.h"
+
+// std::atomic
+#include <atomic>
+
+//------------------------------------------------------------------------------
+//--                         Begin Namespace Reflect                          --
+namespace Reflect {
+
+//------------------------------------------------------------------------------
+//--                              Error Handling                              --
+//------------------------------------------------------------------------------
+
+namespace {
+    // Currently installed error handler, or nullptr if none is installed.
+    std::atomic<ErrorHandler> errorHandler(nullptr);
+}
+
+// Install the error handler.
+ErrorHandler setErrorHandler(ErrorHandler handler) {
+    return errorHandler.exchange(handler);
+}
+
+// Retrieve the currently installed error handler.
+ErrorHandler getErrorHandler() {
+    return errorHandler;
+}
+
+}
+//--                          End Namespace Reflect                           --
+//------------------------------------------------------------------------------
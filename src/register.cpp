@@ -0,0 +1,61 @@
+// Copyright (c) 2019 Johannes Zeppenfeld
+// SPDX-License-Identifier: MIT
+
+#include "reflect/register.h"
+
+#include "reflect/detail/registry_snapshot.h"
+#include "reflect/detail/type_info.h"
+
+// std::atomic
+#include <atomic>
+
+//------------------------------------------------------------------------------
+//--                         Begin Namespace Reflect                          --
+namespace Reflect {
+
+//------------------------------------------------------------------------------
+//--                               Conversions                                --
+//------------------------------------------------------------------------------
+
+namespace {
+    // Global setting enabling transitive conversions.
+    std::atomic<bool> transitiveConversions(false);
+}
+
+// Enable or disable transitive conversions globally.
+void setTransitiveConversions(bool enabled) {
+    transitiveConversions = enabled;
+}
+
+// Returns true if transitive conversions are enabled.
+bool getTransitiveConversions() {
+    return transitiveConversions;
+}
+
+//------------------------------------------------------------------------------
+//--                                 Registry                                 --
+//------------------------------------------------------------------------------
+
+// Compact the base classes and conversions registered for all types.
+void freeze() {
+    Detail::TypeInfo::freeze();
+}
+
+// Returns true if the registry has been frozen.
+bool isFrozen() {
+    return Detail::TypeInfo::isFrozen();
+}
+
+// Write a snapshot of the registered type graph to a file.
+void saveSnapshot(std::string const &path) {
+    Detail::saveRegistrySnapshot(path);
+}
+
+// Load a snapshot of the registered type graph from a file.
+bool loadSnapshot(std::string const &path) {
+    return Detail::loadRegistrySnapshot(path);
+}
+
+}
+//--                          End Namespace Reflect                           --
+//------------------------------------------------------------------------------
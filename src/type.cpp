@@ -3,6 +3,14 @@
 
 #include "reflect/type.h"
 
+#include "reflect/detail/convert.h"
+#include "reflect/detail/error.h"
+#include "reflect/detail/hierarchy.h"
+#include "reflect/detail/name_registry.h"
+
+// std::strlen
+#include <cstring>
+
 //------------------------------------------------------------------------------
 //--                         Begin Namespace Reflect                          --
 namespace Reflect {
@@ -11,79 +19,64 @@ namespace Reflect {
 //--                                Class Type                                --
 //------------------------------------------------------------------------------
 
-//--------------------------------  Operators  ---------------------------------
+//-------------------------------  Base Classes  -------------------------------
 
-// Comparison operators.
-bool operator==(Type const &lhs, Type const &rhs) {
-    return (lhs._typeInfo == rhs._typeInfo &&
-            lhs._constant == rhs._constant &&
-            lhs._reference == rhs._reference);
+// Returns true if the type is base or has base as a registered base class.
+bool Type::isDerivedFrom(Type const &base) const {
+    return Detail::isDerived(getTypeInfo(), base.getTypeInfo());
 }
 
-bool operator!=(Type const &lhs, Type const &rhs) {
-    return (lhs._typeInfo != rhs._typeInfo ||
-            lhs._constant != rhs._constant ||
-            lhs._reference != rhs._reference);
-}
+//-------------------------------  Conversions  --------------------------------
 
-bool operator<(Type const &lhs, Type const &rhs) {
-    if(lhs._typeInfo != rhs._typeInfo) {
-        return (lhs._typeInfo < rhs._typeInfo);
+// Retrieve all types to which the type can be converted through a chain of
+// registered conversions.
+std::vector<Type> Type::getReachableConversions() const {
+    std::vector<Type> types;
+    for(auto &&path : Detail::getConversionPaths(getTypeInfo())) {
+        types.emplace_back(path.target, false, false);
     }
-    if(lhs._constant != rhs._constant) {
-        return rhs._constant;
-    }
-    if(lhs._reference != rhs._reference) {
-        return rhs._reference;
-    }
-    return false;
+    return types;
 }
 
-bool operator<=(Type const &lhs, Type const &rhs) {
-    if(lhs._typeInfo != rhs._typeInfo) {
-        return (lhs._typeInfo < rhs._typeInfo);
-    }
-    if(lhs._constant != rhs._constant) {
-        return rhs._constant;
-    }
-    if(lhs._reference != rhs._reference) {
-        return rhs._reference;
-    }
-    return true;
+//--------------------------------  Operators  ---------------------------------
+
+// Output streaming operator.
+std::ostream &operator<<(std::ostream &os, Type const &type) {
+    os << type.getTypeInfo()->getName();
+    if(type.isConstant()) os << " const";
+    if(type.isReference()) os << " &";
+    return os;
 }
 
-bool operator>(Type const &lhs, Type const &rhs) {
-    if(lhs._typeInfo != rhs._typeInfo) {
-        return (lhs._typeInfo > rhs._typeInfo);
-    }
-    if(lhs._constant != rhs._constant) {
-        return lhs._constant;
-    }
-    if(lhs._reference != rhs._reference) {
-        return lhs._reference;
-    }
-    return false;
+//---------------------------  Non-Member Functions  ---------------------------
+
+// Retrieve the unqualified type globally registered with the specified name.
+Type getType(char const *name) {
+    return getType(name, std::strlen(name));
 }
 
-bool operator>=(Type const &lhs, Type const &rhs) {
-    if(lhs._typeInfo != rhs._typeInfo) {
-        return (lhs._typeInfo > rhs._typeInfo);
-    }
-    if(lhs._constant != rhs._constant) {
-        return lhs._constant;
-    }
-    if(lhs._reference != rhs._reference) {
-        return lhs._reference;
+Type getType(std::string const &name) {
+    return getType(name.data(), name.size());
+}
+
+Type getType(char const *name, std::size_t size) {
+    Detail::TypeInfo const *typeInfo = Detail::findTypeName(name, size);
+    if(!typeInfo) {
+        Detail::raiseError(
+            "No type has been registered with name '"
+            + std::string(name, size) + "'."
+        );
     }
-    return true;
+    return { typeInfo, false, false };
 }
 
-// Output streaming operator.
-std::ostream &operator<<(std::ostream &os, Type const &type) {
-    os << type._typeInfo->getName();
-    if(type.isConstant()) os << " const";
-    if(type.isReference()) os << " &";
-    return os;
+// Look up the unqualified type globally registered with the specified name.
+bool findType(std::string const &name, Type &type) {
+    Detail::TypeInfo const *typeInfo = Detail::findTypeName(name.data(),
+                                                            name.size());
+    if(!typeInfo) return false;
+    type = Type(typeInfo, false, false);
+    return true;
 }
 
 }
@@ -0,0 +1,106 @@
+// Copyright (c) 2019 Johannes Zeppenfeld
+// SPDX-License-Identifier: MIT
+
+#include "common/catch.hpp"
+#include "common/classes.h"
+
+#include "reflect/binding.h"
+#include "reflect/object.h"
+#include "reflect/register.h"
+
+//------------------------------------------------------------------------------
+//--                               Registration                               --
+//------------------------------------------------------------------------------
+
+namespace {
+    struct Grams { double mass; };
+    struct Kilograms { double mass; };
+
+    struct Registration {
+        Registration() {
+            Reflect::Register<Grams>()
+                .conversion<Kilograms>([](Grams const &grams) {
+                    return Kilograms { grams.mass / 1000.0 };
+                })
+            ;
+        }
+    } registration;
+}
+
+//------------------------------------------------------------------------------
+//--                                Test Cases                                --
+//------------------------------------------------------------------------------
+
+TEST_CASE("Apply binding between objects",
+          "[binding]") {
+    Reflect::Binding binding;
+    REQUIRE(!binding.isResolved());
+
+    SECTION("of the same reflected type.") {
+        Reflect::Object<Base> target;
+        Reflect::Object<Base> source = 3;
+        Count<All>::clear();
+
+        binding.apply(target, source);
+        binding.apply(target, source);
+        REQUIRE(binding.isResolved());
+        REQUIRE(Count<Base>::copyAssigned() == 2);
+        REQUIRE(target.get<Base const &>().getFrom()
+                == &source.get<Base const &>());
+    }
+
+    SECTION("from a derived reflected type.") {
+        Reflect::Object<Base> target;
+        Reflect::Object<> source = Derived(5);
+        Count<All>::clear();
+
+        binding.apply(target, source);
+        REQUIRE(Count<Base>::copyAssigned() == 1);
+        REQUIRE(target.get<Base const &>().getFrom()
+                == &source.get<Base const &>());
+    }
+
+    SECTION("using a registered conversion.") {
+        Reflect::Object<> target = Kilograms { 0.0 };
+        Reflect::Object<> source = Grams { 2500.0 };
+
+        binding.apply(target, source);
+        REQUIRE(target.get<Kilograms const &>().mass == Approx(2.5));
+
+        source.get<Grams &>().mass = 500.0;
+        binding.apply(target, source);
+        REQUIRE(target.get<Kilograms const &>().mass == Approx(0.5));
+    }
+
+    SECTION("revalidating when the reflected type changes.") {
+        Reflect::Object<Base> target;
+        Reflect::Object<> base = Base(1);
+        Reflect::Object<> derived = Derived(2);
+        Reflect::Object<> unrelated = Unrelated();
+        Count<All>::clear();
+
+        binding.apply(target, base);
+        REQUIRE(target.get<Base const &>().getFrom()
+                == &base.get<Base const &>());
+
+        binding.apply(target, derived);
+        REQUIRE(target.get<Base const &>().getFrom()
+                == &derived.get<Base const &>());
+        REQUIRE(Count<Base>::copyAssigned() == 2);
+
+        REQUIRE_THROWS_AS(binding.apply(target, unrelated),
+                          std::runtime_error);
+        REQUIRE(!binding.isResolved());
+    }
+
+    SECTION("to a constant target.") {
+        Base const value;
+        Reflect::Object<> target = std::cref(value);
+        Reflect::Object<> source = Base(1);
+        Count<All>::clear();
+
+        REQUIRE_THROWS_AS(binding.apply(target, source), std::runtime_error);
+    }
+
+    REQUIRE(Count<All>::clear());
+}
@@ -3,3 +3,25 @@
 
 #define CATCH_CONFIG_MAIN
 #include "catch.hpp"
+
+#include "reflect/error.h"
+
+#include <stdexcept>
+#include <string>
+
+#if defined(REFLECT_NO_EXCEPTIONS)
+namespace {
+    // Without exceptions, the library aborts once an error has been reported.
+    // The unit tests are built with exceptions regardless, so the error
+    // handler throws to let the test cases check for errors.
+    void throwError(std::string const &message) {
+        throw std::runtime_error(message);
+    }
+
+    struct Registration {
+        Registration() {
+            Reflect::setErrorHandler(&throwError);
+        }
+    } registration;
+}
+#endif
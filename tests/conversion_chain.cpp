@@ -0,0 +1,128 @@
+// Copyright (c) 2019 Johannes Zeppenfeld
+// SPDX-License-Identifier: MIT
+
+#include "common/catch.hpp"
+#include "common/classes.h"
+
+#include "reflect/object.h"
+#include "reflect/register.h"
+
+//------------------------------------------------------------------------------
+//--                               Registration                               --
+//------------------------------------------------------------------------------
+
+namespace {
+    struct Inches { double length; };
+    struct Points { int length; };
+    struct Centimeters { double length; };
+    struct Millimeters { double length; };
+    struct Micrometers { double length; bool rounded; };
+    struct Nanometers { double length; };
+
+    struct Registration {
+        Registration() {
+            Reflect::Register<Inches>()
+                .conversion<Centimeters>([](Inches const &inches) {
+                    return Centimeters { inches.length * 2.54 };
+                })
+                .conversion<Points>([](Inches const &inches) {
+                    return Points { static_cast<int>(inches.length * 72) };
+                }, Reflect::LossyConversionCost)
+            ;
+            Reflect::Register<Points>()
+                .conversion<Micrometers>([](Points const &points) {
+                    return Micrometers { points.length * 352.8, true };
+                })
+            ;
+            Reflect::Register<Centimeters>()
+                .conversion<Millimeters>([](Centimeters const &centimeters) {
+                    return Millimeters { centimeters.length * 10 };
+                })
+            ;
+            Reflect::Register<Millimeters>()
+                .conversion<Micrometers>([](Millimeters const &millimeters) {
+                    return Micrometers { millimeters.length * 1000, false };
+                })
+                .conversion<Derived>([](Millimeters const &millimeters) {
+                    return Derived(static_cast<int>(millimeters.length));
+                })
+            ;
+        }
+    } registration;
+}
+
+//------------------------------------------------------------------------------
+//--                                Test Cases                                --
+//------------------------------------------------------------------------------
+
+TEST_CASE("Convert object value through a chain of conversions",
+          "[object][conversion]") {
+    Reflect::Object<> obj = Inches { 1.0 };
+
+    SECTION("only if transitive conversions are enabled.") {
+        REQUIRE(!Reflect::getTransitiveConversions());
+        REQUIRE_THROWS_AS(obj.get<Millimeters>(), std::runtime_error);
+    }
+
+    Reflect::setTransitiveConversions(true);
+
+    SECTION("retrieving the converted value.") {
+        REQUIRE(obj.get<Millimeters>().length == Approx(25.4));
+    }
+
+    SECTION("preferring the cheapest chain.") {
+        Micrometers micrometers = obj.get<Micrometers>();
+        REQUIRE(!micrometers.rounded);
+        REQUIRE(micrometers.length == Approx(25400.0));
+    }
+
+    SECTION("retrieving a base class of the converted value.") {
+        Count<All>::clear();
+
+        REQUIRE(obj.get<Base>().getInt() == 25);
+        REQUIRE(Count<Derived>::valueConstructed() == 1);
+        Count<All>::clear();
+    }
+
+    SECTION("setting a value from another type.") {
+        Reflect::Object<> target = Micrometers { 0.0, true };
+
+        target.set(Inches { 2.0 });
+        REQUIRE(target.get<Micrometers const &>().length == Approx(50800.0));
+        REQUIRE(!target.get<Micrometers const &>().rounded);
+    }
+
+    SECTION("not retrieving references.") {
+        REQUIRE_THROWS_AS(obj.get<Millimeters const &>(), std::runtime_error);
+    }
+
+    Reflect::setTransitiveConversions(false);
+
+    REQUIRE(Count<All>::clear());
+}
+
+TEST_CASE("Enumerate reachable conversions",
+          "[type][conversion]") {
+    SECTION("ordered by increasing cost.") {
+        auto types = Reflect::getType<Inches>().getReachableConversions();
+        REQUIRE(types.size() == 6);
+        REQUIRE(types.front() == Reflect::getType<Centimeters>());
+        REQUIRE(types[1] == Reflect::getType<Millimeters>());
+        REQUIRE(types.back() == Reflect::getType<Points>());
+    }
+
+    SECTION("including subsequently registered conversions.") {
+        auto types = Reflect::getType<Points>().getReachableConversions();
+        REQUIRE(types.size() == 1);
+
+        Reflect::Register<Micrometers>()
+            .conversion<Nanometers>([](Micrometers const &micrometers) {
+                return Nanometers { micrometers.length * 1000 };
+            })
+        ;
+
+        types = Reflect::getType<Points>().getReachableConversions();
+        REQUIRE(types.size() == 2);
+        REQUIRE(types.back() == Reflect::getType<Nanometers>());
+    }
+}
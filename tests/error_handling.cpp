@@ -0,0 +1,108 @@
+// Copyright (c) 2019 Johannes Zeppenfeld
+// SPDX-License-Identifier: MIT
+
+#include "common/catch.hpp"
+
+#include "reflect/error.h"
+#include "reflect/object.h"
+#include "reflect/register.h"
+#include "reflect/type.h"
+
+#include <string>
+
+//------------------------------------------------------------------------------
+//--                               Registration                               --
+//------------------------------------------------------------------------------
+
+namespace {
+    struct Gauge { int pressure; };
+
+    // Exception thrown by the error handler.
+    struct HandledError {
+        std::string message;
+    };
+
+    void handleError(std::string const &message) {
+        throw HandledError { message };
+    }
+
+    struct Registration {
+        Registration() {
+            Reflect::Register<Gauge>("ErrorHandlingGauge");
+        }
+    } registration;
+}
+
+//------------------------------------------------------------------------------
+//--                                Test Cases                                --
+//------------------------------------------------------------------------------
+
+TEST_CASE("Retrieve object value without raising an error",
+          "[object][access][error]") {
+    SECTION("from an object owning its value.") {
+        Reflect::Object<> obj = Gauge { 3 };
+        REQUIRE(obj.tryGet<Gauge>() == &obj.get<Gauge &>());
+        REQUIRE(obj.tryGet<Gauge const>() == &obj.get<Gauge &>());
+        REQUIRE(obj.tryGet<std::string>() == nullptr);
+    }
+
+    SECTION("from an object referencing a constant value.") {
+        Gauge gauge { 3 };
+        Reflect::Object<> obj = std::cref(gauge);
+        REQUIRE(obj.tryGet<Gauge>() == nullptr);
+        REQUIRE(obj.tryGet<Gauge const>() == &gauge);
+    }
+
+    SECTION("from a constant object.") {
+        Reflect::Object<> const obj = Gauge { 3 };
+        REQUIRE(obj.tryGet<Gauge>()->pressure == 3);
+        REQUIRE(obj.tryGet<int>() == nullptr);
+    }
+}
+
+TEST_CASE("Set object value without raising an error",
+          "[object][access][error]") {
+    Gauge gauge { 3 };
+
+    SECTION("of a mutable value.") {
+        Reflect::Object<> obj = std::ref(gauge);
+        REQUIRE(obj.trySet(Gauge { 5 }));
+        REQUIRE(gauge.pressure == 5);
+        REQUIRE(!obj.trySet(std::string("high")));
+        REQUIRE(gauge.pressure == 5);
+    }
+
+    SECTION("of a constant value.") {
+        Reflect::Object<> obj = std::cref(gauge);
+        Gauge other { 5 };
+        REQUIRE(!obj.trySet(other));
+        REQUIRE(gauge.pressure == 3);
+    }
+}
+
+TEST_CASE("Look up type by name without raising an error",
+          "[type][name][error]") {
+    Reflect::Type type = Reflect::getType<void>();
+    REQUIRE(Reflect::findType("ErrorHandlingGauge", type));
+    REQUIRE(type == Reflect::getType<Gauge>());
+    REQUIRE(!Reflect::findType("ErrorHandlingMissing", type));
+    REQUIRE(type == Reflect::getType<Gauge>());
+}
+
+TEST_CASE("Report errors to the installed error handler",
+          "[error]") {
+    Reflect::ErrorHandler previous = Reflect::setErrorHandler(&handleError);
+    REQUIRE(Reflect::getErrorHandler() == &handleError);
+
+    Reflect::Object<> obj = Gauge { 3 };
+    std::string message;
+    try {
+        obj.get<std::string>();
+    } catch(HandledError const &error) {
+        message = error.message;
+    }
+    REQUIRE(message.find("Could not retrieve type") != std::string::npos);
+    REQUIRE_THROWS_AS(Reflect::getType("ErrorHandlingMissing"), HandledError);
+
+    REQUIRE(Reflect::setErrorHandler(previous) == &handleError);
+}
@@ -12,11 +12,18 @@
 //------------------------------------------------------------------------------
 
 namespace {
+    struct Shape { virtual ~Shape() = default; };
+    struct Circle : Shape { };
+    struct Square : Shape { };
+
     struct Registration {
         Registration() {
             Reflect::Register<Derived>()
                 .base<Base>()
             ;
+            Reflect::Register<Circle>()
+                .base<Shape>()
+            ;
         }
     } registration;
 }
@@ -315,6 +322,48 @@ TEST_CASE("Construct object by referencing a value",
     REQUIRE(Count<All>::clear());
 }
 
+TEST_CASE("Construct object by referencing a value of dynamic type",
+          "[object][construct][by-reference]") {
+    Circle circle;
+    Square square;
+    Derived derived;
+    Count<All>::clear();
+
+    // Without runtime type information, the dynamic type of a value is its
+    // static type.
+#if !defined(REFLECT_NO_RTTI)
+    SECTION("of registered most-derived type.") {
+        Shape &shape = circle;
+        Reflect::Object<Shape> obj = Reflect::dynamicRef(shape);
+        REQUIRE(&obj.get() == &circle);
+        REQUIRE(obj.getType() == Reflect::getType<Circle &>());
+    }
+
+    SECTION("of registered most-derived constant type.") {
+        Shape const &shape = circle;
+        Reflect::Object<> obj = Reflect::dynamicCref(shape);
+        REQUIRE(&obj.get<Shape const &>() == &circle);
+        REQUIRE(obj.getType() == Reflect::getType<Circle const &>());
+    }
+#endif
+
+    SECTION("of unregistered most-derived type.") {
+        Shape &shape = square;
+        Reflect::Object<Shape> obj = Reflect::dynamicRef(shape);
+        REQUIRE(&obj.get() == &square);
+        REQUIRE(obj.getType() == Reflect::getType<Shape &>());
+    }
+
+    SECTION("of non-polymorphic type.") {
+        Base &base = derived;
+        Reflect::Object<Base> obj = Reflect::dynamicRef(base);
+        REQUIRE(Count<All>::constructed() == 0);
+        REQUIRE(obj.getType() == Reflect::getType<Base &>());
+    }
+
+    REQUIRE(Count<All>::clear());
+}
+
 TEST_CASE("Construct object by referencing another object",
           "[object][construct][by-reference]") {
     SECTION("of the same type.") {
@@ -579,3 +628,71 @@ TEST_CASE("Construct object of void type",
 
     REQUIRE(Count<All>::clear());
 }
+
+TEST_CASE("Construct object of derived type from an object of base type",
+          "[object][construct][downcast]") {
+    SECTION("by copying an object containing a derived value.") {
+        Reflect::Object<Base> objBase = Derived();
+        Count<All>::clear();
+
+        Reflect::Object<Derived> obj = objBase;
+        REQUIRE(Count<Derived>::copyConstructed() == 1);
+        REQUIRE(Count<Base>::copyConstructed() == 1);
+        REQUIRE(obj.getType() == Reflect::getType<Derived>());
+    }
+
+    SECTION("by moving an object containing a derived value.") {
+        Reflect::Object<> objVoid = Derived();
+        Count<All>::clear();
+
+        Reflect::Object<Derived> obj = std::move(objVoid);
+        REQUIRE(Count<Derived>::moveConstructed() == 1);
+        REQUIRE(Count<Base>::moveConstructed() == 1);
+        REQUIRE(obj.getType() == Reflect::getType<Derived>());
+    }
+
+    SECTION("throwing if the contained value is not derived.") {
+        Reflect::Object<Base> objBase;
+        Reflect::Object<> objVoid = Unrelated();
+        Count<All>::clear();
+
+        REQUIRE_THROWS_AS(Reflect::Object<Derived>(objBase),
+                          std::runtime_error);
+        REQUIRE_THROWS_AS(Reflect::Object<Derived>(std::ref(objBase)),
+                          std::runtime_error);
+        REQUIRE_THROWS_AS(Reflect::Object<Base>(std::cref(objVoid)),
+                          std::runtime_error);
+        REQUIRE(Count<All>::constructed() == 0);
+    }
+
+    SECTION("by casting without copying the value.") {
+        Derived derived;
+        Reflect::Object<Base> objBase = derived;
+        Reflect::Object<Base> refBase = std::ref(derived);
+        Count<All>::clear();
+
+        Reflect::Object<Derived> obj = Reflect::objectCast<Derived>(objBase);
+        REQUIRE(&obj.get() == &objBase.get<Derived &>());
+        REQUIRE(obj.getType() == Reflect::getType<Derived &>());
+
+        Reflect::Object<Derived> ref = Reflect::objectCast<Derived>(refBase);
+        REQUIRE(&ref.get() == &derived);
+
+        Reflect::Object<Base> const &constBase = refBase;
+        Reflect::Object<Derived> cref = Reflect::objectCast<Derived>(constBase);
+        REQUIRE(&cref.get<Derived const &>() == &derived);
+        REQUIRE(cref.getType() == Reflect::getType<Derived const &>());
+
+        REQUIRE(Count<All>::constructed() == 0);
+    }
+
+    SECTION("throwing if a cast value is not derived.") {
+        Reflect::Object<Base> objBase;
+        Count<All>::clear();
+
+        REQUIRE_THROWS_AS(Reflect::objectCast<Derived>(objBase),
+                          std::runtime_error);
+    }
+
+    REQUIRE(Count<All>::clear());
+}
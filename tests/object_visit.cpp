@@ -0,0 +1,164 @@
+// Copyright (c) 2019 Johannes Zeppenfeld
+// SPDX-License-Identifier: MIT
+
+#include "common/catch.hpp"
+#include "common/classes.h"
+
+#include "reflect/object.h"
+#include "reflect/register.h"
+#include "reflect/visit.h"
+
+//------------------------------------------------------------------------------
+//--                               Registration                               --
+//------------------------------------------------------------------------------
+
+namespace {
+    struct Celsius { double degrees; };
+    struct Kelvin { double degrees; };
+
+    struct Registration {
+        Registration() {
+            Reflect::Register<Celsius>()
+                .conversion<Kelvin>([](Celsius const &celsius) {
+                    return Kelvin { celsius.degrees + 273.15 };
+                })
+            ;
+        }
+    } registration;
+
+    int visitInt(int) { return 1; }
+}
+
+//------------------------------------------------------------------------------
+//--                                Test Cases                                --
+//------------------------------------------------------------------------------
+
+TEST_CASE("Visit object value",
+          "[object][visit]") {
+    SECTION("matching the reflected type exactly.") {
+        Reflect::Object<> obj = 42;
+        int result = Reflect::visit(obj,
+            [](double) { return 2; },
+            &visitInt,
+            [](std::string const &) { return 3; }
+        );
+        REQUIRE(result == 1);
+    }
+
+    SECTION("preferring the reflected type over its base class.") {
+        Reflect::Object<Base> obj = Derived();
+        Count<All>::clear();
+
+        int result = Reflect::visit(obj,
+            [](Base const &) { return 1; },
+            [](Derived const &) { return 2; }
+        );
+        REQUIRE(result == 2);
+        REQUIRE(Count<All>::constructed() == 0);
+    }
+
+    SECTION("falling back to a base class.") {
+        Reflect::Object<> obj = Derived(7);
+        Count<All>::clear();
+
+        int result = Reflect::visit(obj,
+            [](Unrelated const &) { return 0; },
+            [](Base const &base) { return base.getInt(); }
+        );
+        REQUIRE(result == 7);
+        REQUIRE(Count<All>::constructed() == 0);
+    }
+
+    SECTION("falling back to a registered conversion.") {
+        Reflect::Object<> obj = Celsius { 10.0 };
+
+        double result = Reflect::visit(obj,
+            [](int) { return 0.0; },
+            [](Kelvin const &kelvin) { return kelvin.degrees; }
+        );
+        REQUIRE(result == Approx(283.15));
+    }
+
+    SECTION("preferring a base class over a registered conversion.") {
+        Reflect::Object<> obj = Celsius { 10.0 };
+
+        double result = Reflect::visit(obj,
+            [](Kelvin kelvin) { return kelvin.degrees; },
+            [](Celsius celsius) { return celsius.degrees; }
+        );
+        REQUIRE(result == Approx(10.0));
+    }
+
+    SECTION("by mutable reference.") {
+        Reflect::Object<> obj = Derived(1);
+        Count<All>::clear();
+
+        Reflect::visit(obj, [](Base &base) { base = 5; });
+        REQUIRE(Count<Base>::valueAssigned() == 1);
+        REQUIRE(obj.get<Base const &>().getInt() == 5);
+    }
+
+    SECTION("skipping mutable references to constant values.") {
+        Derived const derived(3);
+        Reflect::Object<> obj = std::ref(derived);
+        Count<All>::clear();
+
+        int result = Reflect::visit(obj,
+            [](Base &) { return 1; },
+            [](Base const &) { return 2; }
+        );
+        REQUIRE(result == 2);
+
+        REQUIRE_THROWS_AS(
+            Reflect::visit(obj, [](Derived &) { }),
+            std::runtime_error
+        );
+    }
+
+    SECTION("of a constant object.") {
+        Reflect::Object<> const obj = Derived(3);
+        Count<All>::clear();
+
+        int result = Reflect::visit(obj,
+            [](Derived &) { return 1; },
+            [](Base const &base) { return base.getInt(); }
+        );
+        REQUIRE(result == 3);
+    }
+
+    SECTION("without a matching visitor.") {
+        Reflect::Object<> obj = Unrelated();
+        Count<All>::clear();
+
+        REQUIRE_THROWS_AS(
+            Reflect::visit(obj,
+                [](Base const &) { },
+                [](Kelvin) { }
+            ),
+            std::runtime_error
+        );
+    }
+
+    REQUIRE(Count<All>::clear());
+}
+
+TEST_CASE("Visit object values of changing reflected types",
+          "[object][visit]") {
+    auto visitor = [](Reflect::Object<> const &obj) {
+        return Reflect::visit(obj,
+            [](int) { return 'i'; },
+            [](std::string const &) { return 's'; },
+            [](Base const &) { return 'b'; },
+            [](Kelvin) { return 'k'; }
+        );
+    };
+
+    for(int i = 0; i < 2; ++i) {
+        REQUIRE(visitor(42) == 'i');
+        REQUIRE(visitor(std::string("hello")) == 's');
+        REQUIRE(visitor(Derived()) == 'b');
+        REQUIRE(visitor(Celsius { 0.0 }) == 'k');
+    }
+
+    Count<All>::clear();
+}
@@ -0,0 +1,187 @@
+// Copyright (c) 2019 Johannes Zeppenfeld
+// SPDX-License-Identifier: MIT
+
+#include "common/catch.hpp"
+#include "common/classes.h"
+
+#include "reflect/object.h"
+#include "reflect/one_of.h"
+#include "reflect/register.h"
+#include "reflect/visit.h"
+
+//------------------------------------------------------------------------------
+//--                               Registration                               --
+//------------------------------------------------------------------------------
+
+namespace {
+    struct Meters { double length; };
+    struct Feet { double length; };
+
+    struct Registration {
+        Registration() {
+            Reflect::Register<Feet>()
+                .conversion<Meters>([](Feet const &feet) {
+                    return Meters { feet.length * 0.3048 };
+                })
+            ;
+        }
+    } registration;
+
+    using Payload = Reflect::OneOf<Base, Derived, Meters>;
+}
+
+//------------------------------------------------------------------------------
+//--                                Test Cases                                --
+//------------------------------------------------------------------------------
+
+TEST_CASE("Construct OneOf",
+          "[one_of]") {
+    SECTION("storing values inline.") {
+        REQUIRE(sizeof(Payload) <= sizeof(Derived) + alignof(Derived));
+        REQUIRE(Payload::indexOf<Derived>() == 1);
+        REQUIRE(Payload::indexOf<Unrelated>() == 3);
+    }
+
+    SECTION("with the first alternative by default.") {
+        Payload oneOf;
+        REQUIRE(oneOf.getIndex() == 0);
+        REQUIRE(oneOf.getType() == Reflect::getType<Base>());
+        REQUIRE(Count<All>::defaultConstructed() == 1);
+        REQUIRE(Count<All>::clear() == 1);
+    }
+
+    SECTION("from an alternative.") {
+        Derived derived(5);
+        Count<All>::clear();
+
+        Payload oneOf = derived;
+        REQUIRE(oneOf.getIndex() == 1);
+        REQUIRE(oneOf.get<Derived const &>().getInt() == 5);
+        REQUIRE(Count<Derived>::copyConstructed() == 1);
+
+        Payload copy = oneOf;
+        REQUIRE(copy.getIndex() == 1);
+        REQUIRE(Count<Derived>::copyConstructed() == 1);
+
+        Payload moved = std::move(copy);
+        REQUIRE(moved.getIndex() == 1);
+        REQUIRE(Count<Derived>::moveConstructed() == 1);
+        Count<All>::clear();
+    }
+
+    SECTION("from an object of an alternative type.") {
+        Reflect::Object<> obj = Derived(3);
+        Count<All>::clear();
+
+        Payload oneOf(obj);
+        REQUIRE(oneOf.getIndex() == 1);
+        REQUIRE(oneOf.get<Base const &>().getInt() == 3);
+        REQUIRE(Count<Derived>::copyConstructed() == 1);
+        Count<All>::clear();
+    }
+
+    SECTION("from an object using a registered conversion.") {
+        Reflect::Object<> obj = Feet { 10.0 };
+
+        Payload oneOf(obj);
+        REQUIRE(oneOf.getIndex() == 2);
+        REQUIRE(oneOf.get<Meters>().length == Approx(3.048));
+    }
+
+    SECTION("from an object without a matching alternative.") {
+        Reflect::Object<> obj = Unrelated();
+        Count<All>::clear();
+
+        REQUIRE_THROWS_AS(Payload(obj), std::runtime_error);
+        Count<All>::clear();
+    }
+
+    REQUIRE(Count<All>::clear());
+}
+
+TEST_CASE("Access OneOf value",
+          "[one_of]") {
+    SECTION("retrieving the contained alternative.") {
+        Payload oneOf = Derived(1);
+        Count<All>::clear();
+
+        oneOf.get<Derived &>() = 2;
+        REQUIRE(oneOf.get<Derived>().getInt() == 2);
+        REQUIRE(Count<Derived>::valueAssigned() == 1);
+        REQUIRE(Count<Derived>::copyConstructed() == 1);
+        Count<All>::clear();
+    }
+
+    SECTION("retrieving a registered base class.") {
+        Payload oneOf = Derived(4);
+        Count<All>::clear();
+
+        REQUIRE(oneOf.get<Base &>().getInt() == 4);
+        REQUIRE(Count<All>::constructed() == 0);
+        REQUIRE_THROWS_AS(oneOf.get<Unrelated const &>(), std::runtime_error);
+        Count<All>::clear();
+    }
+
+    SECTION("setting another alternative.") {
+        Payload oneOf = Derived(1);
+        Count<All>::clear();
+
+        oneOf.set(Meters { 2.0 });
+        REQUIRE(oneOf.getIndex() == 2);
+        REQUIRE(oneOf.get<Meters const &>().length == Approx(2.0));
+        REQUIRE(Count<All>::clear());
+
+        oneOf.set(Base(6));
+        REQUIRE(oneOf.getIndex() == 0);
+        REQUIRE(oneOf.get<Base const &>().getInt() == 6);
+        Count<All>::clear();
+    }
+
+    SECTION("setting the contained alternative using a conversion.") {
+        Payload oneOf = Meters { 1.0 };
+
+        oneOf.set(Feet { 10.0 });
+        REQUIRE(oneOf.getIndex() == 2);
+        REQUIRE(oneOf.get<Meters const &>().length == Approx(3.048));
+
+        oneOf = Base();
+        Count<All>::clear();
+        REQUIRE_THROWS_AS(oneOf.set(Feet { 1.0 }), std::runtime_error);
+        REQUIRE(oneOf.getIndex() == 0);
+    }
+
+    SECTION("setting from an object.") {
+        Payload oneOf;
+        Reflect::Object<> obj = Feet { 1.0 };
+        Count<All>::clear();
+
+        oneOf.set(obj);
+        REQUIRE(oneOf.getIndex() == 2);
+        REQUIRE(Count<All>::constructed() == 0);
+    }
+
+    SECTION("retrieving a copy as an object.") {
+        Payload oneOf = Derived(8);
+        Count<All>::clear();
+
+        Reflect::Object<> obj = oneOf.getObject();
+        REQUIRE(obj.getType() == Reflect::getType<Derived>());
+        REQUIRE(obj.get<Base const &>().getInt() == 8);
+        REQUIRE(Count<Derived>::copyConstructed() == 1);
+        Count<All>::clear();
+    }
+
+    SECTION("visiting the contained value.") {
+        Payload oneOf = Derived(9);
+        Count<All>::clear();
+
+        int result = Reflect::visit(oneOf,
+            [](Meters) { return 0; },
+            [](Base &base) { return base.getInt(); }
+        );
+        REQUIRE(result == 9);
+        REQUIRE(Count<All>::constructed() == 0);
+    }
+
+    REQUIRE(Count<All>::clear());
+}
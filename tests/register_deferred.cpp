@@ -0,0 +1,90 @@
+// Copyright (c) 2019 Johannes Zeppenfeld
+// SPDX-License-Identifier: MIT
+
+#include "common/catch.hpp"
+
+#include "reflect/object.h"
+#include "reflect/register.h"
+
+#include <stdexcept>
+
+//------------------------------------------------------------------------------
+//--                               Registration                               --
+//------------------------------------------------------------------------------
+
+namespace {
+    struct Vehicle { int wheels; };
+    struct Car : Vehicle { };
+    struct Truck : Vehicle { };
+    struct Bicycle { };
+    struct Cargo { };
+
+    // Number of times each deferred registration has been executed.
+    int carRegistrations = 0;
+    int truckRegistrations = 0;
+
+    Reflect::DeferredRegister<Car> registerCar([]() {
+        ++carRegistrations;
+        Reflect::Register<Car>("DeferredCar")
+            .base<Vehicle>()
+        ;
+    });
+
+    Reflect::DeferredRegister<Truck> registerTruck([]() {
+        ++truckRegistrations;
+        Reflect::Register<Truck>("DeferredTruck")
+            .base<Vehicle>()
+        ;
+    });
+
+    Reflect::DeferredRegister<Truck> registerTruckConversion([]() {
+        ++truckRegistrations;
+        Reflect::Register<Truck>()
+            .conversion<Cargo>([](Truck const &) { return Cargo(); })
+        ;
+    });
+
+    Reflect::DeferredRegister<Bicycle> registerBicycle([]() {
+        // Retrieving information about the type being registered must not
+        // execute the registration again.
+        Reflect::getType<Bicycle>().getName();
+        Reflect::Register<Bicycle>("DeferredBicycle");
+    });
+}
+
+//------------------------------------------------------------------------------
+//--                                Test Cases                                --
+//------------------------------------------------------------------------------
+
+TEST_CASE("Defer registration",
+          "[register][deferred]") {
+    SECTION("until information about the type is retrieved.") {
+        REQUIRE_THROWS_AS(Reflect::getType("DeferredCar"), std::runtime_error);
+        REQUIRE(carRegistrations == 0);
+
+        REQUIRE(Reflect::getType<Car>().getName() == "DeferredCar");
+        REQUIRE(carRegistrations == 1);
+        REQUIRE(Reflect::getType("DeferredCar") == Reflect::getType<Car>());
+    }
+
+    SECTION("until the type is used by an object.") {
+        Reflect::Object<> obj = Car();
+        obj.get<Car &>().wheels = 4;
+        REQUIRE(obj.get<Vehicle const &>().wheels == 4);
+        REQUIRE(carRegistrations == 1);
+    }
+
+    SECTION("executing multiple registrations of a type once each.") {
+        Reflect::Object<> obj = Truck();
+        REQUIRE_NOTHROW(obj.get<Cargo>());
+        REQUIRE_NOTHROW(obj.get<Vehicle const &>());
+        REQUIRE(truckRegistrations == 2);
+
+        REQUIRE(Reflect::getType<Truck>().getName() == "DeferredTruck");
+        REQUIRE(truckRegistrations == 2);
+    }
+
+    SECTION("retrieving information while executing the registration.") {
+        REQUIRE(Reflect::getType<Bicycle>().getName() == "DeferredBicycle");
+    }
+}
@@ -0,0 +1,98 @@
+// Copyright (c) 2019 Johannes Zeppenfeld
+// SPDX-License-Identifier: MIT
+
+#include "common/catch.hpp"
+
+#include "reflect/object.h"
+#include "reflect/register.h"
+
+#include <stdexcept>
+
+//------------------------------------------------------------------------------
+//--                               Registration                               --
+//------------------------------------------------------------------------------
+
+namespace {
+    struct Fruit {
+        virtual ~Fruit() = default;
+        int seeds;
+    };
+    struct Apple : Fruit { };
+    struct Juice { int volume; };
+    struct Pear : Fruit {
+        operator Juice() const { return Juice { 200 }; }
+    };
+    struct Plum { };
+
+    constexpr Reflect::StaticBase appleBases[] = {
+        Reflect::staticBase<Apple, Fruit>()
+    };
+
+    constexpr Reflect::StaticBase pearBases[] = {
+        Reflect::staticBase<Pear, Fruit>()
+    };
+
+    constexpr Reflect::StaticConversion pearConversions[] = {
+        Reflect::staticConversion<Pear, Juice>()
+    };
+
+    constexpr Reflect::StaticType types[] = {
+        Reflect::staticType<Fruit>("StaticFruit"),
+        Reflect::staticType<Apple>("StaticApple", appleBases),
+        Reflect::staticType<Pear>(nullptr, pearBases, pearConversions)
+    };
+
+    constexpr Reflect::StaticType conflictingTypes[] = {
+        Reflect::staticType<Plum>("StaticPlum"),
+        Reflect::staticType<Plum>("StaticApple", pearConversions)
+    };
+
+    struct Registration {
+        Registration() {
+            Reflect::registerStatic(types);
+        }
+    } registration;
+}
+
+//------------------------------------------------------------------------------
+//--                                Test Cases                                --
+//------------------------------------------------------------------------------
+
+TEST_CASE("Register types statically",
+          "[register][static]") {
+    SECTION("with names.") {
+        REQUIRE(Reflect::getType("StaticFruit") == Reflect::getType<Fruit>());
+        REQUIRE(Reflect::getType<Apple>().getName() == "StaticApple");
+    }
+
+    SECTION("with base classes.") {
+        Reflect::Object<> obj = Apple();
+        obj.get<Apple &>().seeds = 5;
+        REQUIRE(obj.get<Fruit const &>().seeds == 5);
+    }
+
+    SECTION("with conversions.") {
+        Reflect::Object<> obj = Pear();
+        REQUIRE(obj.get<Juice>().volume == 200);
+        REQUIRE_NOTHROW(obj.get<Fruit const &>());
+    }
+
+#if !defined(REFLECT_NO_RTTI)
+    SECTION("as dynamic types.") {
+        Apple apple;
+        Fruit const &fruit = apple;
+        Reflect::Object<> obj = Reflect::dynamicCref(fruit);
+        REQUIRE(obj.getType() == Reflect::getType<Apple const &>());
+    }
+#endif
+
+    SECTION("throwing if a name belongs to a different type.") {
+        REQUIRE_THROWS_AS(Reflect::registerStatic(conflictingTypes),
+                          std::runtime_error);
+        REQUIRE(Reflect::getType("StaticApple") == Reflect::getType<Apple>());
+
+        // No conversions were registered.
+        auto conversions = Reflect::getType<Plum>().getConversions();
+        REQUIRE(conversions.begin() == conversions.end());
+    }
+}
@@ -0,0 +1,160 @@
+// Copyright (c) 2019 Johannes Zeppenfeld
+// SPDX-License-Identifier: MIT
+
+#include "common/catch.hpp"
+
+#include "reflect/object.h"
+#include "reflect/register.h"
+
+// std::atomic
+#include <atomic>
+#include <stdexcept>
+#include <string>
+// std::thread
+#include <thread>
+// std::vector
+#include <vector>
+
+//------------------------------------------------------------------------------
+//--                               Registration                               --
+//------------------------------------------------------------------------------
+
+namespace {
+    constexpr int TargetCount = 64;
+    constexpr int ReaderCount = 4;
+
+    struct Source { int value; };
+    template <int T_Index> struct Target { int value; };
+    template <int T_Index> struct Child : Target<T_Index> { };
+
+    void registerTargets(std::integral_constant<int, 0>) { }
+
+    // Register conversions from Source to Target<1> through
+    // Target<T_Index>, as well as base classes and names of each target.
+    template <int T_Index>
+    void registerTargets(std::integral_constant<int, T_Index>) {
+        registerTargets(std::integral_constant<int, T_Index - 1>());
+
+        Reflect::Register<Source>()
+            .conversion<Target<T_Index>>([](Source const &source) {
+                return Target<T_Index> { source.value + T_Index };
+            })
+        ;
+        Reflect::Register<Target<T_Index>>(
+            "ConcurrentTarget" + std::to_string(T_Index)
+        );
+        Reflect::Register<Child<T_Index>>()
+            .template base<Target<T_Index>>()
+        ;
+    }
+
+    int retrieveTargets(Reflect::Object<> const &,
+                        std::integral_constant<int, 0>) {
+        return 0;
+    }
+
+    // Retrieve each target from obj, which must contain Source { 0 }.
+    // Returns the number of targets retrieved, or -1 if a target was
+    // retrieved incorrectly.
+    template <int T_Index>
+    int retrieveTargets(Reflect::Object<> const &obj,
+                        std::integral_constant<int, T_Index>) {
+        int count = retrieveTargets(obj,
+                                    std::integral_constant<int, T_Index - 1>());
+        if(count < 0) return count;
+
+        try {
+            if(obj.get<Target<T_Index>>().value != T_Index) return -1;
+        } catch(std::runtime_error const &) {
+            return count;
+        }
+        return count + 1;
+    }
+
+    int lookUpTargets(std::integral_constant<int, 0>) {
+        return 0;
+    }
+
+    // Look up each target by name.
+    // Returns the number of targets found, or -1 if a name was found to
+    // refer to the wrong type.
+    template <int T_Index>
+    int lookUpTargets(std::integral_constant<int, T_Index>) {
+        int count = lookUpTargets(std::integral_constant<int, T_Index - 1>());
+        if(count < 0) return count;
+
+        static std::string const name = "ConcurrentTarget"
+                                      + std::to_string(T_Index);
+        try {
+            if(Reflect::getType(name) != Reflect::getType<Target<T_Index>>()) {
+                return -1;
+            }
+        } catch(std::runtime_error const &) {
+            return count;
+        }
+        return count + 1;
+    }
+}
+
+//------------------------------------------------------------------------------
+//--                                Test Cases                                --
+//------------------------------------------------------------------------------
+
+TEST_CASE("Register types concurrently with their use",
+          "[register][concurrency]") {
+    using Targets = std::integral_constant<int, TargetCount>;
+
+    std::atomic<bool> done(false);
+    std::atomic<int> failures(0);
+    std::atomic<int> iterations(0);
+
+    std::vector<std::thread> readers;
+    for(int i = 0; i < ReaderCount; ++i) {
+        readers.emplace_back([&]() {
+            Reflect::Object<> obj = Source { 0 };
+            Reflect::Object<> child = Child<TargetCount>();
+
+            // Perform at least one iteration after registration has finished.
+            bool finished = false;
+            while(!finished) {
+                finished = done;
+
+                int retrieved = retrieveTargets(obj, Targets());
+                int found = lookUpTargets(Targets());
+                if(retrieved < 0 || found < 0) ++failures;
+
+                // Once registration has finished, all targets must be
+                // available.
+                if(finished && (retrieved != TargetCount ||
+                                found != TargetCount)) {
+                    ++failures;
+                }
+
+                bool upcast = true;
+                try {
+                    child.get<Target<TargetCount> const &>();
+                } catch(std::runtime_error const &) {
+                    upcast = false;
+                }
+                if(finished && !upcast) ++failures;
+
+                ++iterations;
+            }
+        });
+    }
+
+    // Let readers start before registering.
+    while(iterations < ReaderCount) std::this_thread::yield();
+
+    registerTargets(Targets());
+    Reflect::freeze();
+    done = true;
+
+    for(auto &&reader : readers) {
+        reader.join();
+    }
+
+    REQUIRE(failures == 0);
+    REQUIRE(Reflect::getType<Source>().getReachableConversions().size()
+            == TargetCount);
+}
@@ -0,0 +1,95 @@
+// Copyright (c) 2019 Johannes Zeppenfeld
+// SPDX-License-Identifier: MIT
+
+#include "common/catch.hpp"
+
+#include "reflect/object.h"
+#include "reflect/register.h"
+
+//------------------------------------------------------------------------------
+//--                               Registration                               --
+//------------------------------------------------------------------------------
+
+namespace {
+    struct Animal { int legs; };
+    struct Pet { bool named; };
+    struct Dog : Animal, Pet { };
+    struct Bird : Animal { };
+    struct Snake { };
+
+    // Count the number of elements in range.
+    template <typename T_Range>
+    std::size_t count(T_Range const &range) {
+        std::size_t count = 0;
+        for(auto it = range.begin(); it != range.end(); ++it) ++count;
+        return count;
+    }
+
+    struct Registration {
+        Registration() {
+            Reflect::Register<Dog>()
+                .base<Animal>()
+            ;
+            Reflect::Register<Bird>()
+                .base<Animal>()
+                .conversion<Snake>([](Bird const &) { return Snake(); })
+            ;
+        }
+    } registration;
+}
+
+//------------------------------------------------------------------------------
+//--                                Test Cases                                --
+//------------------------------------------------------------------------------
+
+TEST_CASE("Freeze registry",
+          "[register][freeze]") {
+    Reflect::freeze();
+    REQUIRE(Reflect::isFrozen());
+
+    SECTION("retaining registered base classes.") {
+        auto bases = Reflect::getType<Dog>().getBases();
+        REQUIRE(count(bases) == 1);
+        REQUIRE(*bases.begin() == Reflect::getType<Animal>());
+
+        Reflect::Object<> obj = Dog();
+        obj.get<Dog &>().legs = 4;
+        REQUIRE(obj.get<Animal const &>().legs == 4);
+    }
+
+    SECTION("retaining registered conversions.") {
+        auto conversions = Reflect::getType<Bird>().getConversions();
+        REQUIRE(count(conversions) == 1);
+        REQUIRE(*conversions.begin() == Reflect::getType<Snake>());
+
+        Reflect::Object<> obj = Bird();
+        REQUIRE_NOTHROW(obj.get<Snake>());
+    }
+
+    SECTION("multiple times without effect.") {
+        auto bases = Reflect::getType<Bird>().getBases();
+        Reflect::freeze();
+        REQUIRE(Reflect::getType<Bird>().getBases().begin() == bases.begin());
+    }
+
+    SECTION("and continue registering afterwards.") {
+        Reflect::Register<Dog>()
+            .base<Pet>()
+        ;
+        REQUIRE(!Reflect::isFrozen());
+
+        auto bases = Reflect::getType<Dog>().getBases();
+        REQUIRE(count(bases) == 2);
+        REQUIRE(*bases.begin() == Reflect::getType<Animal>());
+        auto it = bases.begin();
+        REQUIRE(*++it == Reflect::getType<Pet>());
+
+        Reflect::freeze();
+        REQUIRE(Reflect::isFrozen());
+
+        Reflect::Object<> obj = Dog();
+        obj.get<Dog &>().named = true;
+        REQUIRE(obj.get<Pet const &>().named);
+        REQUIRE(count(Reflect::getType<Bird>().getBases()) == 1);
+    }
+}
@@ -0,0 +1,133 @@
+// Copyright (c) 2019 Johannes Zeppenfeld
+// SPDX-License-Identifier: MIT
+
+#include "common/catch.hpp"
+
+#include "reflect/object.h"
+#include "reflect/register.h"
+
+// std::remove
+#include <cstdio>
+// std::ifstream, std::ofstream
+#include <fstream>
+// std::istreambuf_iterator
+#include <iterator>
+#include <string>
+// std::thread
+#include <thread>
+
+//------------------------------------------------------------------------------
+//--                               Registration                               --
+//------------------------------------------------------------------------------
+
+namespace {
+    struct Seconds { double count; };
+    struct Minutes { double count; };
+    struct Hours { double count; };
+    struct Duration { double seconds; };
+    struct Days : Duration { };
+
+    struct Registration {
+        Registration() {
+            Reflect::Register<Seconds>()
+                .conversion<Minutes>([](Seconds const &seconds) {
+                    return Minutes { seconds.count / 60 };
+                })
+            ;
+            Reflect::Register<Minutes>()
+                .conversion<Hours>([](Minutes const &minutes) {
+                    return Hours { minutes.count / 60 };
+                })
+            ;
+            Reflect::Register<Hours>()
+                .conversion<Days>([](Hours const &hours) {
+                    Days days;
+                    days.seconds = hours.count * 3600;
+                    return days;
+                })
+            ;
+            Reflect::Register<Days>()
+                .base<Duration>()
+            ;
+        }
+    } registration;
+
+    // Name of the snapshot file written by the tests.
+    char const *const snapshotPath = "registry_snapshot.bin";
+
+    // Read the entire contents of the snapshot file.
+    std::string readSnapshot() {
+        std::ifstream file(snapshotPath, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(file),
+                           std::istreambuf_iterator<char>());
+    }
+
+    // Replace the contents of the snapshot file.
+    void writeSnapshot(std::string const &contents) {
+        std::ofstream file(snapshotPath, std::ios::binary | std::ios::trunc);
+        file << contents;
+    }
+}
+
+//------------------------------------------------------------------------------
+//--                                Test Cases                                --
+//------------------------------------------------------------------------------
+
+TEST_CASE("Snapshot the registered type graph",
+          "[register][snapshot]") {
+    Reflect::setTransitiveConversions(true);
+    Reflect::saveSnapshot(snapshotPath);
+
+    SECTION("loading it if it matches the registered type graph.") {
+        REQUIRE(Reflect::loadSnapshot(snapshotPath));
+
+        Reflect::Object<> obj = Seconds { 7200.0 };
+        REQUIRE(obj.get<Hours>().count == Approx(2.0));
+        REQUIRE(obj.get<Duration>().seconds == Approx(7200.0));
+    }
+
+    SECTION("using the loaded chains of conversions on other threads.") {
+        REQUIRE(Reflect::loadSnapshot(snapshotPath));
+
+        double seconds = 0;
+        std::thread thread([&]() {
+            Reflect::Object<> obj = Minutes { 90.0 };
+            seconds = obj.get<Duration>().seconds;
+        });
+        thread.join();
+        REQUIRE(seconds == Approx(5400.0));
+    }
+
+    SECTION("rejecting a missing file.") {
+        REQUIRE(!Reflect::loadSnapshot("missing_snapshot.bin"));
+    }
+
+    SECTION("rejecting a truncated file.") {
+        std::string contents = readSnapshot();
+        writeSnapshot(contents.substr(0, contents.size() - 1));
+        REQUIRE(!Reflect::loadSnapshot(snapshotPath));
+    }
+
+    SECTION("rejecting a file of a different format.") {
+        std::string contents = readSnapshot();
+        contents[0] = 'X';
+        writeSnapshot(contents);
+        REQUIRE(!Reflect::loadSnapshot(snapshotPath));
+    }
+
+    SECTION("rejecting a snapshot of a different type graph.") {
+        struct Weeks { double count; };
+        Reflect::Register<Days>()
+            .conversion<Weeks>([](Days const &days) {
+                return Weeks { days.seconds / 604800 };
+            })
+        ;
+        REQUIRE(!Reflect::loadSnapshot(snapshotPath));
+
+        Reflect::Object<> obj = Seconds { 1209600.0 };
+        REQUIRE(obj.get<Weeks>().count == Approx(2.0));
+    }
+
+    std::remove(snapshotPath);
+    Reflect::setTransitiveConversions(false);
+}
@@ -0,0 +1,112 @@
+// Copyright (c) 2019 Johannes Zeppenfeld
+// SPDX-License-Identifier: MIT
+
+#include "common/catch.hpp"
+
+#include "reflect/object.h"
+#include "reflect/register.h"
+#include "reflect/type.h"
+
+#include <stdexcept>
+
+//------------------------------------------------------------------------------
+//--                               Registration                               --
+//------------------------------------------------------------------------------
+
+namespace {
+    // Single inheritance.
+    struct Instrument { };
+    struct StringInstrument : Instrument { };
+    struct Violin : StringInstrument { };
+    struct Cello : StringInstrument { };
+    struct Trumpet : Instrument { };
+
+    // Multiple inheritance.
+    struct Valuable { };
+    struct Owned : Valuable { };
+    struct Insured : Valuable { };
+    struct OwnedViolin : Violin, Owned, Insured { };
+
+    struct Sound { };
+    struct Echo : Sound { };
+
+    struct Registration {
+        Registration() {
+            Reflect::Register<StringInstrument>().base<Instrument>();
+            Reflect::Register<Violin>().base<StringInstrument>();
+            Reflect::Register<Cello>().base<StringInstrument>();
+            Reflect::Register<Trumpet>().base<Instrument>();
+            Reflect::Register<Owned>().base<Valuable>();
+            Reflect::Register<Insured>().base<Valuable>();
+            Reflect::Register<OwnedViolin>()
+                .base<Violin>()
+                .base<Owned>()
+                .base<Insured>()
+            ;
+        }
+    } registration;
+
+    template <typename T_Derived, typename T_Base>
+    bool isDerived() {
+        return Reflect::getType<T_Derived>().isDerivedFrom(
+            Reflect::getType<T_Base>()
+        );
+    }
+}
+
+//------------------------------------------------------------------------------
+//--                                Test Cases                                --
+//------------------------------------------------------------------------------
+
+TEST_CASE("Query whether a type is derived from another",
+          "[type][base]") {
+    SECTION("for the same type.") {
+        REQUIRE(isDerived<Violin, Violin>());
+        REQUIRE(isDerived<Sound, Sound>());
+    }
+
+    SECTION("within a single inheritance hierarchy.") {
+        REQUIRE(isDerived<Violin, StringInstrument>());
+        REQUIRE(isDerived<Violin, Instrument>());
+        REQUIRE(isDerived<Trumpet, Instrument>());
+        REQUIRE(!isDerived<Trumpet, StringInstrument>());
+        REQUIRE(!isDerived<Violin, Cello>());
+        REQUIRE(!isDerived<Instrument, Violin>());
+    }
+
+    SECTION("within a multiple inheritance hierarchy.") {
+        REQUIRE(isDerived<OwnedViolin, Violin>());
+        REQUIRE(isDerived<OwnedViolin, Instrument>());
+        REQUIRE(isDerived<OwnedViolin, Owned>());
+        REQUIRE(isDerived<OwnedViolin, Valuable>());
+        REQUIRE(!isDerived<OwnedViolin, Cello>());
+        REQUIRE(!isDerived<Violin, OwnedViolin>());
+        REQUIRE(!isDerived<Valuable, Owned>());
+    }
+
+    SECTION("disregarding qualifiers.") {
+        REQUIRE(Reflect::getType<Violin const &>().isDerivedFrom(
+            Reflect::getType<Instrument>()
+        ));
+    }
+
+    SECTION("for unrelated types.") {
+        REQUIRE(!isDerived<Violin, Sound>());
+        REQUIRE(!isDerived<Sound, Instrument>());
+        REQUIRE(!isDerived<Echo, Sound>());
+    }
+
+    SECTION("reflecting base classes registered after querying.") {
+        REQUIRE(!isDerived<Echo, Sound>());
+        Reflect::Register<Echo>().base<Sound>();
+        REQUIRE(isDerived<Echo, Sound>());
+    }
+}
+
+TEST_CASE("Reject retrieving a reference to a type that is not a base class",
+          "[type][base]") {
+    Reflect::Object<> obj = OwnedViolin();
+    REQUIRE_NOTHROW(obj.get<Valuable &>());
+    REQUIRE_NOTHROW(obj.get<Instrument const &>());
+    REQUIRE_THROWS_AS(obj.get<Cello &>(), std::runtime_error);
+}
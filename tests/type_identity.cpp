@@ -0,0 +1,36 @@
+// Copyright (c) 2019 Johannes Zeppenfeld
+// SPDX-License-Identifier: MIT
+
+#include "common/catch.hpp"
+
+#include "reflect/object.h"
+#include "reflect/type.h"
+
+//------------------------------------------------------------------------------
+//--                               Registration                               --
+//------------------------------------------------------------------------------
+
+namespace {
+    // Shares its name with a type within an anonymous namespace of another
+    // test, from which it must remain distinct.
+    struct Gauge { double reading; };
+}
+
+//------------------------------------------------------------------------------
+//--                                Test Cases                                --
+//------------------------------------------------------------------------------
+
+TEST_CASE("Identify types by their type information",
+          "[type][identity]") {
+    SECTION("of the same type.") {
+        REQUIRE(Reflect::getType<int>() == Reflect::getType<int>());
+        Reflect::Object<> obj = 5;
+        REQUIRE(obj.getType() == Reflect::getType<int>());
+    }
+
+    SECTION("of a local type sharing its name with another local type.") {
+        Reflect::Type gauge = Reflect::getType<Gauge>();
+        REQUIRE(gauge != Reflect::getType("ErrorHandlingGauge"));
+        REQUIRE(gauge.getSize() == sizeof(double));
+    }
+}
@@ -0,0 +1,78 @@
+// Copyright (c) 2019 Johannes Zeppenfeld
+// SPDX-License-Identifier: MIT
+
+#include "common/catch.hpp"
+
+#include "reflect/object.h"
+#include "reflect/type.h"
+
+#include <string>
+
+//------------------------------------------------------------------------------
+//--                               Registration                               --
+//------------------------------------------------------------------------------
+
+namespace {
+    struct alignas(16) Packet {
+        int header;
+        char payload[20];
+    };
+
+    struct Handle {
+        ~Handle() { }
+        int value;
+    };
+
+    struct Polymorphic {
+        virtual ~Polymorphic() = default;
+    };
+}
+
+//------------------------------------------------------------------------------
+//--                                Test Cases                                --
+//------------------------------------------------------------------------------
+
+TEST_CASE("Retrieve layout properties of a type",
+          "[type][layout]") {
+    SECTION("of a trivial type.") {
+        Reflect::Type type = Reflect::getType<Packet>();
+        REQUIRE(type.getSize() == sizeof(Packet));
+        REQUIRE(type.getAlignment() == 16);
+        REQUIRE(type.isTriviallyCopyable());
+        REQUIRE(type.isTriviallyDestructible());
+        REQUIRE(type.isStandardLayout());
+    }
+
+    SECTION("of a type with a destructor.") {
+        Reflect::Type type = Reflect::getType<Handle>();
+        REQUIRE(type.getSize() == sizeof(int));
+        REQUIRE(!type.isTriviallyCopyable());
+        REQUIRE(!type.isTriviallyDestructible());
+        REQUIRE(type.isStandardLayout());
+    }
+
+    SECTION("of a polymorphic type.") {
+        Reflect::Type type = Reflect::getType<Polymorphic>();
+        REQUIRE(type.getAlignment() == alignof(Polymorphic));
+        REQUIRE(!type.isTriviallyCopyable());
+        REQUIRE(!type.isStandardLayout());
+    }
+
+    SECTION("disregarding qualifiers.") {
+        Reflect::Type type = Reflect::getType<std::string const &>();
+        REQUIRE(type.getSize() == sizeof(std::string));
+        REQUIRE(!type.isTriviallyDestructible());
+    }
+
+    SECTION("of void.") {
+        Reflect::Type type = Reflect::getType<void>();
+        REQUIRE(type.getSize() == 0);
+        REQUIRE(type.getAlignment() == 0);
+    }
+
+    SECTION("of an object's reflected type.") {
+        Reflect::Object<> obj = 3.5;
+        REQUIRE(obj.getType().getSize() == sizeof(double));
+        REQUIRE(obj.getType().isTriviallyCopyable());
+    }
+}
@@ -0,0 +1,207 @@
+// Copyright (c) 2019 Johannes Zeppenfeld
+// SPDX-License-Identifier: MIT
+
+#include "common/catch.hpp"
+
+#include "reflect/register.h"
+#include "reflect/type.h"
+
+// std::next
+#include <iterator>
+#include <map>
+#include <string>
+#include <unordered_map>
+
+//------------------------------------------------------------------------------
+//--                               Registration                               --
+//------------------------------------------------------------------------------
+
+namespace {
+    struct Widget { };
+    struct Gadget { };
+    struct Gimmick { };
+    template <int T_Index> struct Numbered { };
+
+    template <int T_Index>
+    void registerNumbered() {
+        Reflect::Register<Numbered<T_Index>>(
+            "Numbered" + std::to_string(T_Index)
+        );
+        registerNumbered<T_Index - 1>();
+    }
+
+    template <>
+    void registerNumbered<0>() { }
+
+    struct Registration {
+        Registration() {
+            Reflect::Register<Widget>("TypeNameWidget");
+            Reflect::Register<Widget>("Widget");
+            Reflect::Register<Widget>("TypeNameLongWidget");
+            Reflect::Register<Gadget>("Gadget");
+        }
+    } registration;
+}
+
+//------------------------------------------------------------------------------
+//--                                Test Cases                                --
+//------------------------------------------------------------------------------
+
+TEST_CASE("Register type with name",
+          "[type][name]") {
+    SECTION("retaining the shortest name.") {
+        REQUIRE(Reflect::getType<Widget>().getName() == "Widget");
+        REQUIRE(Reflect::getType<Gadget>().getName() == "Gadget");
+    }
+
+    SECTION("repeating a name of the same type.") {
+        REQUIRE_NOTHROW(Reflect::Register<Widget>("Widget"));
+        REQUIRE(Reflect::getType<Widget>().getName() == "Widget");
+    }
+
+    SECTION("throwing if the name belongs to a different type.") {
+        REQUIRE_THROWS_AS(Reflect::Register<Gadget>("TypeNameWidget"),
+                          std::runtime_error);
+        REQUIRE(Reflect::getType("TypeNameWidget")
+                == Reflect::getType<Widget>());
+        REQUIRE(Reflect::getType<Gadget>().getName() == "Gadget");
+    }
+}
+
+TEST_CASE("Look up type by name",
+          "[type][name]") {
+    SECTION("from a null-terminated string.") {
+        REQUIRE(Reflect::getType("Widget") == Reflect::getType<Widget>());
+        REQUIRE(Reflect::getType("TypeNameLongWidget")
+                == Reflect::getType<Widget>());
+        REQUIRE(Reflect::getType("Gadget") == Reflect::getType<Gadget>());
+    }
+
+    SECTION("from a standard string.") {
+        REQUIRE(Reflect::getType(std::string("Gadget"))
+                == Reflect::getType<Gadget>());
+    }
+
+    SECTION("from a string that is not null-terminated.") {
+        char const *names = "GadgetWidget";
+        REQUIRE(Reflect::getType(names, 6) == Reflect::getType<Gadget>());
+        REQUIRE(Reflect::getType(names + 6, 6) == Reflect::getType<Widget>());
+    }
+
+    SECTION("resulting in an unqualified type.") {
+        Reflect::Type type = Reflect::getType("Widget");
+        REQUIRE(!type.isConstant());
+        REQUIRE(!type.isReference());
+    }
+
+    SECTION("throwing if no type has been registered with the name.") {
+        REQUIRE_THROWS_AS(Reflect::getType("Gizmo"), std::runtime_error);
+        REQUIRE_THROWS_AS(Reflect::getType("Widge"), std::runtime_error);
+        REQUIRE_THROWS_AS(Reflect::getType(""), std::runtime_error);
+    }
+
+    SECTION("among a large number of registered names.") {
+        registerNumbered<100>();
+
+        REQUIRE(Reflect::getType("Numbered1")
+                == Reflect::getType<Numbered<1>>());
+        REQUIRE(Reflect::getType("Numbered57")
+                == Reflect::getType<Numbered<57>>());
+        REQUIRE(Reflect::getType("Numbered100")
+                == Reflect::getType<Numbered<100>>());
+        REQUIRE(Reflect::getType("Widget") == Reflect::getType<Widget>());
+    }
+}
+
+TEST_CASE("Hash type",
+          "[type][name]") {
+    SECTION("identically across invocations of the program.") {
+        // 64-bit FNV-1a hash of the first registered name, TypeNameWidget.
+        REQUIRE(Reflect::getType<Widget>().getHash()
+                == (0xd5cb44e2cdeacc12ull * 0x100000001b3ull));
+    }
+
+    SECTION("distinguishing qualifiers.") {
+        REQUIRE(Reflect::getType<Widget>().getHash()
+                != Reflect::getType<Widget const>().getHash());
+        REQUIRE(Reflect::getType<Widget &>().getHash()
+                != Reflect::getType<Widget const &>().getHash());
+        REQUIRE(Reflect::getType<Widget>().getHash()
+                != Reflect::getType<Gadget>().getHash());
+    }
+
+    SECTION("using types as keys of unordered containers.") {
+        std::unordered_map<Reflect::Type, int> values;
+        values[Reflect::getType<Widget>()] = 1;
+        values[Reflect::getType<Widget &>()] = 2;
+        values[Reflect::getType<Gadget>()] = 3;
+        REQUIRE(values.size() == 3);
+        REQUIRE(values.at(Reflect::getType("Widget")) == 1);
+        REQUIRE(values.at(Reflect::getType<Gadget>()) == 3);
+    }
+
+    SECTION("ordering types by their hashes.") {
+        std::map<Reflect::Type, int> values;
+        values[Reflect::getType<Widget>()] = 1;
+        values[Reflect::getType<Gadget>()] = 2;
+        REQUIRE((values.begin()->first.getHash()
+                 < std::next(values.begin())->first.getHash()));
+        REQUIRE(values.at(Reflect::getType<Widget>()) == 1);
+    }
+}
+
+TEST_CASE("Compare types",
+          "[type]") {
+    SECTION("represented by a single word.") {
+        REQUIRE(sizeof(Reflect::Type) == sizeof(void *));
+    }
+
+    SECTION("distinguishing qualifiers.") {
+        Reflect::Type type = Reflect::getType<Widget>();
+        Reflect::Type constant = Reflect::getType<Widget const>();
+        Reflect::Type constReference = Reflect::getType<Widget const &>();
+
+        REQUIRE(type == Reflect::getType("Widget"));
+        REQUIRE(type != constant);
+        REQUIRE(constant.isConstant());
+        REQUIRE(!constant.isReference());
+        REQUIRE(constReference.isConstant());
+        REQUIRE(constReference.isReference());
+        REQUIRE(constReference.getName() == "Widget");
+    }
+
+    SECTION("ordering qualified types after unqualified types.") {
+        Reflect::Type type = Reflect::getType<Widget>();
+        Reflect::Type constant = Reflect::getType<Widget const>();
+        Reflect::Type reference = Reflect::getType<Widget &>();
+        Reflect::Type constReference = Reflect::getType<Widget const &>();
+
+        REQUIRE(type < reference);
+        REQUIRE(reference < constant);
+        REQUIRE(constant < constReference);
+        REQUIRE(constReference > type);
+        REQUIRE(type <= type);
+        REQUIRE(type >= type);
+        REQUIRE(!(type < type));
+    }
+}
+
+#if defined(REFLECT_NO_RTTI)
+TEST_CASE("Retrieve compile-time name of unregistered type",
+          "[type][name]") {
+    SECTION("of a fundamental type.") {
+        REQUIRE(Reflect::getType<int>().getName() == "int");
+        REQUIRE(Reflect::getType<double const &>().getName() == "double");
+    }
+
+    SECTION("of a class type.") {
+        std::string name = Reflect::getType<Gimmick>().getName();
+        REQUIRE(name.find("Gimmick") != std::string::npos);
+    }
+
+    SECTION("interned once per type.") {
+        std::string const &name = Reflect::getType<Gimmick>().getName();
+        REQUIRE(&Reflect::getType<Gimmick const &>().getName() == &name);
+    }
+}
+#endif